@@ -0,0 +1,69 @@
+/*****************************************************************************/
+
+/*
+ *      bench-malloc.c  --  counts the allocations of a program, for make bench
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Preloaded by lsusb-bench, this stands in front of the C library's
+ * allocator, counting every malloc(), calloc() and realloc() and the
+ * bytes asked for, and at exit writes "allocations bytes" to the file
+ * descriptor in $LSUSB_BENCH_FD.  It needs glibc, whose allocator can
+ * be called as __libc_malloc() and friends.
+ */
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static unsigned long allocs;
+static unsigned long long bytes;
+
+static void count(size_t size)
+{
+	__atomic_add_fetch(&allocs, 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&bytes, size, __ATOMIC_RELAXED);
+}
+
+void *malloc(size_t size)
+{
+	count(size);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	count(nmemb * size);
+	return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	count(size);
+	return __libc_realloc(ptr, size);
+}
+
+static void __attribute__((destructor)) report(void)
+{
+	const char *fd = getenv("LSUSB_BENCH_FD");
+
+	if (fd)
+		dprintf(atoi(fd), "%lu %llu\n", allocs, bytes);
+}
@@ -0,0 +1,55 @@
+#!/bin/sh
+# bench-startup.sh -- times lsusb built from two revisions
+# Run by "make bench-startup BEFORE=rev [AFTER=rev]" in the build
+# directory; GPL v2 or later.
+#
+# Each revision is exported from git, configured with the options this
+# build was configured with, and built.  Then "lsusb -d ffff:ffff" is
+# timed: it starts, sets up the name tables and enumerates the bus, but
+# matches and prints nothing.  The name tables used to be hashed on
+# every start; with BEFORE set to a revision from before they were
+# hashed at build time, the two lines show what that cost.  AFTER
+# defaults to HEAD.  One tab separated line per revision, times are the
+# median of BENCH_RUNS runs.
+#
+# BENCH_ARGS replaces "-d ffff:ffff" to time another mode; with it set
+# empty, the plain listing is run, and syscalls divided by devices is
+# what listing one device costs at each revision.
+
+srcdir=${srcdir:-.}
+runs=${BENCH_RUNS:-25}
+work=${BENCH_DIR:-bench-startup.d}
+before=${BEFORE:?give the revision to compare with, as BEFORE=rev}
+after=${AFTER:-HEAD}
+args=${BENCH_ARGS--d ffff:ffff}
+
+bench="$(pwd)/lsusb-bench -n $runs"
+[ -f bench-malloc.so ] && bench="$bench -a $(pwd)/bench-malloc.so"
+# the configure options of this build, quoted for the shell
+eval "set -- $(./config.status --config)"
+
+rm -rf "$work" && mkdir -p "$work" || exit 1
+work=$(cd "$work" && pwd)
+
+printf 'revision\tcommit\tdevices\twall_ms\tuser_ms\tsys_ms\tmaxrss_kb\tsyscalls\tallocs\talloc_bytes\tstatus\n'
+for rev in "$before" "$after"; do
+	commit=$(git -C "$srcdir" rev-parse --short "$rev^{commit}") || exit 1
+	dir="$work/$commit"
+	[ -d "$dir" ] || {
+		mkdir -p "$dir" &&
+		git -C "$srcdir" archive "$commit" | tar -x -C "$dir" &&
+		# a submodule, the same for both revisions
+		if [ -x "$srcdir/usbhid-dump/bootstrap" ]; then
+			cp -R "$srcdir/usbhid-dump" "$dir/" &&
+			(cd "$dir/usbhid-dump" && ./bootstrap)
+		fi &&
+		(cd "$dir" && autoreconf --install && ./configure "$@" && make)
+	} >"$dir.log" 2>&1 || {
+		echo "bench-startup: building $rev failed, see $dir.log" >&2
+		exit 1
+	}
+	devices=$("$dir/lsusb" 2>/dev/null | wc -l)
+	# args split into words on purpose
+	printf '%s\t%s\t%s\t%s\n' "$rev" "$commit" "$devices" \
+		"$($bench "$dir/lsusb" $args)"
+done
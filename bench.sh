@@ -0,0 +1,81 @@
+#!/bin/sh
+# bench.sh -- times lsusb in each mode on made up and recorded buses
+# Run by "make bench" in the build directory; GPL v2 or later.
+#
+# Every input is run through lsusb-replay, so nothing here needs a USB
+# device: trees from gen-usb-sysfs.py of each size in BENCH_SIZES, the
+# same buses saved with --save and replayed from the snapshot, and any
+# files from "lsusb -v --save" on real hosts listed in BENCH_RECORDINGS.
+# For each input and mode one tab separated line is printed; the order,
+# columns and formatting do not change from run to run, so two results
+# can be diffed.  Times are the median of BENCH_RUNS runs.
+
+srcdir=${srcdir:-.}
+PYTHON=${PYTHON:-python3}
+runs=${BENCH_RUNS:-5}
+sizes=${BENCH_SIZES:-"100 1000 5000"}
+work=${BENCH_DIR:-bench.d}
+
+replay=./lsusb-replay
+bench="./lsusb-bench -n $runs"
+[ -f bench-malloc.so ] && bench="$bench -a ./bench-malloc.so"
+
+rm -rf "$work" && mkdir -p "$work" || exit 1
+# -D compares absolute paths
+work=$(cd "$work" && pwd)
+
+# input devices mode: a line of measurements
+row() {
+	input=$1 devices=$2 mode=$3
+	shift 3
+	printf '%s\t%s\t%s\t%s\n' "$input" "$devices" "$mode" "$($bench "$@")"
+}
+
+# what lsusb --timing says name lookups took in a listing, in ms
+names_ms() {
+	"$replay" --timing "$@" 2>&1 >/dev/null |
+		awk '$1 == "names" { ms += $3 } END { printf "%.3f", ms }'
+}
+
+inputs() {
+	echo "empty $work/empty"
+	for n in $sizes; do
+		echo "sysfs-$n $work/sysfs-$n"
+		echo "snapshot-$n $work/sysfs-$n.snap"
+	done
+	for f in $BENCH_RECORDINGS; do
+		echo "$(basename "$f") $f"
+	done
+}
+
+# the inputs; a hundred devices a bus, hubs seven ports wide, five tiers deep
+"$PYTHON" "$srcdir/gen-usb-sysfs.py" -b 1 -n 1 "$work/empty" >/dev/null || exit 1
+for n in $sizes; do
+	b=$(( (n + 99) / 100 ))
+	"$PYTHON" "$srcdir/gen-usb-sysfs.py" -b $b -f 7 -d 5 -H 2 -n $n \
+		"$work/sysfs-$n" >/dev/null || exit 1
+	LSUSB_REPLAY="$work/sysfs-$n" "$replay" -v --save "$work/sysfs-$n.snap" \
+		>/dev/null 2>&1 || exit 1
+done
+
+printf 'input\tdevices\tmode\twall_ms\tuser_ms\tsys_ms\tmaxrss_kb\tsyscalls\tallocs\talloc_bytes\tstatus\n'
+inputs | while read input path; do
+	export LSUSB_REPLAY="$path"
+	devices=$("$replay" 2>/dev/null | wc -l)
+	if [ "$input" = empty ]; then
+		# startup and names_init, with nothing to look up
+		row "$input" "$devices" names_init "$replay" -d ffff:ffff
+		continue
+	fi
+	printf '%s\t%s\tnames\t%s\t-\t-\t-\t-\t-\t-\t0\n' "$input" "$devices" "$(names_ms)"
+	row "$input" "$devices" list "$replay"
+	row "$input" "$devices" tree "$replay" -t
+	row "$input" "$devices" verbose "$replay" -v
+	# -D finds its device by the node under the tree's dev/bus/usb;
+	# --devices reads the tree itself
+	if [ -d "$path/dev/bus/usb" ]; then
+		node=$(ls -d "$path"/dev/bus/usb/001/* | sed -n 2p)
+		row "$input" "$devices" dump "$replay" -D "$node"
+		row "$input" "$devices" devices env LSUSB_SYSROOT="$path" "$replay" --devices
+	fi
+done
@@ -0,0 +1,285 @@
+#!/usr/bin/env python
+# gen-usb-sysfs.py
+# Builds a made up USB tree, as sysfs shows one, for testing and timing
+# lsusb without the hardware.  GPL v2 or later.
+# Usage: See usage()
+#
+# The tree goes under DIR/sys, laid out like the real one: devices nested
+# below their hub in DIR/sys/devices, linked from DIR/sys/bus/usb/devices,
+# with the attributes, the binary "descriptors" file and the interface
+# driver links lsusb and libusb read, and DIR/sys/dev/char links to the
+# devices by node number.  DIR/dev/bus/usb gets the device nodes as empty
+# files.  Run lsusb on it with
+#	LSUSB_REPLAY=DIR ./lsusb-replay -t
+# or point a normal lsusb's sysfs lookups at it with LSUSB_SYSROOT=DIR.
+# The same options always give the same tree.
+
+import os, sys, getopt, struct
+
+buses = 4
+fanout = 4
+depth = 3
+hubs = 1
+maxdevices = 0
+interfaces = 2
+seed = 1
+suspended = 0
+configs = 0
+
+# what a function's interfaces can be:
+# (class, subclass, protocol, driver or None, endpoints as (address, attributes, size, interval))
+kinds = (
+	(0x03, 0x01, 0x01, "usbhid", ((0x81, 3, 8, 10),)),
+	(0x03, 0x00, 0x02, "usbhid", ((0x81, 3, 4, 10),)),
+	(0x08, 0x06, 0x50, "usb-storage", ((0x81, 2, 512, 0), (0x02, 2, 512, 0))),
+	(0x02, 0x02, 0x01, "cdc_acm", ((0x82, 3, 16, 64),)),
+	(0x0a, 0x00, 0x00, "cdc_acm", ((0x83, 2, 64, 0), (0x04, 2, 64, 0))),
+	(0x01, 0x01, 0x00, "snd-usb-audio", ()),
+	(0x0e, 0x01, 0x00, "uvcvideo", ((0x87, 3, 16, 6),)),
+	(0xe0, 0x01, 0x01, "btusb", ((0x81, 3, 16, 1), (0x82, 2, 64, 0), (0x02, 2, 64, 0))),
+	(0xff, 0xff, 0xff, None, ((0x81, 2, 512, 0),)),
+)
+
+# (idVendor, idProduct, manufacturer, product, speed, bcdUSB)
+functions = (
+	(0x046d, 0xc31c, "Logitech", "USB Keyboard", "1.5", 0x0110),
+	(0x0781, 0x5567, "SanDisk", "Cruzer Blade", "480", 0x0200),
+	(0x2341, 0x0043, "Arduino (www.arduino.cc)", "Uno", "12", 0x0110),
+	(0x046d, 0x0825, "Logitech", "Webcam C270", "480", 0x0200),
+	(0x8087, 0x0a2b, "Intel Corp.", "Bluetooth", "12", 0x0200),
+	(0x0bda, 0x8153, "Realtek", "USB 10/100/1000 LAN", "5000", 0x0300),
+)
+
+hub_function = (0x05e3, 0x0608, "GenesysLogic", "USB2.0 Hub", "480", 0x0200)
+
+def usage():
+	sys.stderr.write("Usage: gen-usb-sysfs.py [options] DIR\n"
+		" -b, --buses N       root hubs (default 4)\n"
+		" -f, --fanout N      ports per hub, up to 15 (default 4)\n"
+		" -d, --depth N       tiers, root hub included, 2 to 7 (default 3)\n"
+		" -H, --hubs N        ports of each hub with a hub, the rest have devices (default 1)\n"
+		" -n, --devices N     stop after N devices besides the root hubs (default no limit)\n"
+		" -i, --interfaces N  interfaces per device (default 2)\n"
+		" -s, --seed N        picks the devices (default 1)\n"
+		" -S, --suspended N   every Nth device is runtime suspended (default none)\n"
+		" -c, --configs N     every Nth device has a second, inactive configuration (default none)\n")
+
+class Picker:
+	"The same picks from a seed in any Python, unlike random"
+	def __init__(self, seed):
+		self.state = seed & 0x7fffffff
+
+	def choice(self, seq):
+		self.state = (self.state * 1103515245 + 12345) & 0x7fffffff
+		return seq[(self.state >> 16) % len(seq)]
+
+def write(path, value):
+	f = open(path, "wb")
+	if not isinstance(value, bytearray):
+		value = bytearray((value + "\n").encode("ascii"))
+	f.write(value)
+	f.close()
+
+def link(target, name):
+	os.symlink(os.path.relpath(target, os.path.dirname(name)), name)
+
+class Device:
+	def __init__(self, bus, ports, devnum, hub, rng):
+		self.bus = bus
+		self.ports = ports
+		self.devnum = devnum
+		self.hub = hub
+		self.intfs = []
+		if not ports:
+			self.name = "usb%d" % bus
+			self.function = (0x1d6b, 0x0002, "Linux usbgen ehci_hcd",
+					 "EHCI Host Controller", "480", 0x0200)
+		else:
+			self.name = "%d-%s" % (bus, ".".join([str(p) for p in ports]))
+			self.function = hub and hub_function or rng.choice(functions)
+		if hub:
+			self.intfs = [(0x09, 0x00, 0x00, "hub", ((0x81, 3, 1, 12),))]
+		else:
+			self.intfs = [rng.choice(kinds) for i in range(interfaces)]
+		# the first configuration is the active one, the only one with interfaces in sysfs
+		self.configs = [self.intfs]
+		if configs and ports and not hub and devnum % configs == 0:
+			self.configs.append([kinds[-1]])
+
+	def descriptors(self):
+		vid, pid, mfg, prod, speed, bcdusb = self.function
+		d = bytearray(struct.pack("<BBHBBBBHHHBBBB", 18, 1, bcdusb,
+			self.hub and 9 or 0, 0, self.hub and 1 or 0, 64,
+			vid, pid, 0x0100, 1, 2, 3, len(self.configs)))
+		for value, intfs in enumerate(self.configs):
+			body = bytearray()
+			for n, (cls, sub, proto, driver, eps) in enumerate(intfs):
+				body += struct.pack("<BBBBBBBBB", 9, 4, n, 0, len(eps), cls, sub, proto, 0)
+				for (addr, attr, size, interval) in eps:
+					body += struct.pack("<BBBBHB", 7, 5, addr, attr, size, interval)
+			d += struct.pack("<BBHBBBBB", 9, 2, 9 + len(body), len(intfs), value + 1, 0,
+					 self.hub and 0xe0 or 0x80, 50)
+			d += body
+		return d
+
+	def create(self, root, parent):
+		vid, pid, mfg, prod, speed, bcdusb = self.function
+		path = os.path.join(parent, self.name)
+		os.mkdir(path)
+		link(path, os.path.join(root, "sys/bus/usb/devices", self.name))
+		link(path, os.path.join(root, "sys/dev/char/189:%d" %
+					((self.bus - 1) * 128 + self.devnum - 1)))
+		attrs = {
+			"busnum": "%d" % self.bus,
+			"devnum": "%d" % self.devnum,
+			"devpath": self.ports and ".".join([str(p) for p in self.ports]) or "0",
+			"speed": speed,
+			"version": "%2x.%02x" % (bcdusb >> 8, bcdusb & 0xff),
+			"idVendor": "%04x" % vid,
+			"idProduct": "%04x" % pid,
+			"bcdDevice": "0100",
+			"bDeviceClass": "%02x" % (self.hub and 9 or 0),
+			"bDeviceSubClass": "00",
+			"bDeviceProtocol": "%02x" % (self.hub and 1 or 0),
+			"bMaxPacketSize0": "64",
+			"bNumConfigurations": "%d" % len(self.configs),
+			"bConfigurationValue": "1",
+			"bmAttributes": "%2x" % (self.hub and 0xe0 or 0x80),
+			"bMaxPower": "100mA",
+			"bNumInterfaces": "%2d" % len(self.intfs),
+			"configuration": "",
+			"manufacturer": mfg,
+			"product": prod,
+			"serial": "%08X" % ((self.bus << 24) | (len(self.ports) << 20) | self.devnum),
+			"maxchild": "%d" % (self.hub and fanout or 0),
+			"removable": self.ports and "removable" or "unknown",
+		}
+		for name in attrs:
+			write(os.path.join(path, name), attrs[name])
+		write(os.path.join(path, "descriptors"), self.descriptors())
+		os.mkdir(os.path.join(path, "ep_00"))
+		for (name, value) in (("bEndpointAddress", "00"), ("bInterval", "00"),
+				      ("bLength", "07"), ("bmAttributes", "00"),
+				      ("wMaxPacketSize", "0040")):
+			write(os.path.join(path, "ep_00", name), value)
+		# hubs stay awake, as they do while anything below them is
+		asleep = suspended and not self.hub and self.devnum % suspended == 0
+		os.mkdir(os.path.join(path, "power"))
+		write(os.path.join(path, "power", "control"), "auto")
+		write(os.path.join(path, "power", "runtime_status"),
+		      asleep and "suspended" or "active")
+
+		# a root hub's interface is named as if it sat on port 0
+		prefix = self.ports and self.name or "%d-0" % self.bus
+		for n, (cls, sub, proto, driver, eps) in enumerate(self.intfs):
+			intf = os.path.join(path, "%s:1.%d" % (prefix, n))
+			os.mkdir(intf)
+			link(intf, os.path.join(root, "sys/bus/usb/devices", os.path.basename(intf)))
+			for (name, value) in (("bInterfaceNumber", "%02x" % n),
+					      ("bAlternateSetting", " 0"),
+					      ("bNumEndpoints", "%02x" % len(eps)),
+					      ("bInterfaceClass", "%02x" % cls),
+					      ("bInterfaceSubClass", "%02x" % sub),
+					      ("bInterfaceProtocol", "%02x" % proto)):
+				write(os.path.join(intf, name), value)
+			if driver:
+				drv = os.path.join(root, "sys/bus/usb/drivers", driver)
+				if not os.path.isdir(drv):
+					os.mkdir(drv)
+				link(drv, os.path.join(intf, "driver"))
+
+		dev = os.path.join(root, "dev/bus/usb/%03d" % self.bus)
+		if not os.path.isdir(dev):
+			os.mkdir(dev)
+		write(os.path.join(dev, "%03d" % self.devnum), bytearray())
+		return path
+
+# the number of devices made, and whether a bus ran out of addresses
+def generate(root):
+	rng = Picker(seed)
+	for d in ("sys/bus/usb/devices", "sys/bus/usb/drivers", "sys/devices/pci0000:00",
+		  "sys/dev/char", "dev/bus/usb"):
+		os.makedirs(os.path.join(root, d))
+	queue = []
+	for bus in range(1, buses + 1):
+		pci = os.path.join(root, "sys/devices/pci0000:00/0000:00:%02x.0" % bus)
+		os.mkdir(pci)
+		drv = os.path.join(root, "sys/bus/pci/drivers/ehci-pci")
+		if not os.path.isdir(drv):
+			os.makedirs(drv)
+		link(drv, os.path.join(pci, "driver"))
+		rh = Device(bus, [], 1, True, rng)
+		queue.append((rh, rh.create(root, pci)))
+	# breadth first over all buses at once, so a limit keeps the tree even
+	nextnum = dict([(bus, 2) for bus in range(1, buses + 1)])
+	count = 0
+	full = False
+	while queue:
+		hub, path = queue.pop(0)
+		tier = len(hub.ports) + 1
+		for port in range(1, fanout + 1):
+			if maxdevices and count >= maxdevices:
+				return count, full
+			if nextnum[hub.bus] > 127:
+				full = True
+				break
+			child = Device(hub.bus, hub.ports + [port], nextnum[hub.bus],
+				       port <= hubs and tier + 1 < depth, rng)
+			nextnum[hub.bus] += 1
+			count += 1
+			cpath = child.create(root, path)
+			if child.hub:
+				queue.append((child, cpath))
+	return count, full
+
+def main(argv):
+	global buses, fanout, depth, hubs, maxdevices, interfaces, seed, suspended, configs
+	try:
+		(optlist, args) = getopt.gnu_getopt(argv[1:], "b:f:d:H:n:i:s:S:c:h",
+			("buses=", "fanout=", "depth=", "hubs=", "devices=",
+			 "interfaces=", "seed=", "suspended=", "configs=", "help"))
+		for (opt, arg) in optlist:
+			if opt in ("-h", "--help"):
+				usage()
+				return 0
+			value = int(arg)
+			if opt in ("-b", "--buses"):
+				buses = value
+			elif opt in ("-f", "--fanout"):
+				fanout = value
+			elif opt in ("-d", "--depth"):
+				depth = value
+			elif opt in ("-H", "--hubs"):
+				hubs = value
+			elif opt in ("-n", "--devices"):
+				maxdevices = value
+			elif opt in ("-i", "--interfaces"):
+				interfaces = value
+			elif opt in ("-s", "--seed"):
+				seed = value
+			elif opt in ("-S", "--suspended"):
+				suspended = value
+			elif opt in ("-c", "--configs"):
+				configs = value
+	except (getopt.GetoptError, ValueError):
+		usage()
+		return 2
+	if len(args) != 1 or not 1 <= buses <= 255 or not 1 <= fanout <= 15 or \
+	   not 2 <= depth <= 7 or hubs < 0 or maxdevices < 0 or not 1 <= interfaces <= 32 or \
+	   suspended < 0 or configs < 0:
+		usage()
+		return 2
+	if os.path.exists(args[0]) and os.listdir(args[0]):
+		sys.stderr.write("%s is not empty\n" % args[0])
+		return 1
+	count, full = generate(args[0])
+	sys.stdout.write("%d buses, %d devices in %s\n" % (buses, count, args[0]))
+	if maxdevices and count < maxdevices and full:
+		sys.stderr.write("only %d devices fit in this tree, with 127 addresses a bus\n" % count)
+	elif maxdevices and count < maxdevices:
+		sys.stderr.write("only %d devices fit in this tree, with %d tiers, %d ports "
+				 "a hub and %d of them hubs\n" % (count, depth, fanout, min(hubs, fanout)))
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main(sys.argv))
@@ -0,0 +1,145 @@
+/*****************************************************************************/
+
+/*
+ *      json.c  --  streaming JSON writer
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+
+#include "json.h"
+
+/* ---------------------------------------------------------------------- */
+
+static void json_quote(FILE *f, const char *s)
+{
+	const unsigned char *p = (const unsigned char *)s;
+
+	putc('"', f);
+	for (; *p; p++) {
+		if (*p == '"' || *p == '\\') {
+			putc('\\', f);
+			putc(*p, f);
+		} else if (*p < 0x20)
+			fprintf(f, "\\u%04x", *p);
+		else
+			putc(*p, f);
+	}
+	putc('"', f);
+}
+
+/* comma, line break and key before a value */
+static void json_key(struct json *j, const char *key)
+{
+	if (j->depth && j->depth <= JSON_MAX_DEPTH) {
+		if (!j->empty[j->depth - 1])
+			putc(',', j->f);
+		j->empty[j->depth - 1] = 0;
+	}
+	/* one line per element of the outer array keeps the output greppable */
+	if (j->depth == 2 && !key)
+		putc('\n', j->f);
+	if (key) {
+		json_quote(j->f, key);
+		putc(':', j->f);
+	}
+}
+
+static void json_open(struct json *j, const char *key, int c)
+{
+	json_key(j, key);
+	putc(c, j->f);
+	if (j->depth < JSON_MAX_DEPTH)
+		j->empty[j->depth] = 1;
+	j->depth++;
+}
+
+static void json_close(struct json *j, int c)
+{
+	if (!j->depth)
+		return;
+	j->depth--;
+	if (j->depth == 1)
+		putc('\n', j->f);
+	putc(c, j->f);
+	if (!j->depth)
+		putc('\n', j->f);
+}
+
+void json_init(struct json *j, FILE *f)
+{
+	j->f = f;
+	j->depth = 0;
+}
+
+void json_object_begin(struct json *j, const char *key)
+{
+	json_open(j, key, '{');
+}
+
+void json_object_end(struct json *j)
+{
+	json_close(j, '}');
+}
+
+void json_array_begin(struct json *j, const char *key)
+{
+	json_open(j, key, '[');
+}
+
+void json_array_end(struct json *j)
+{
+	json_close(j, ']');
+}
+
+void json_string(struct json *j, const char *key, const char *s)
+{
+	json_key(j, key);
+	json_quote(j->f, s);
+}
+
+void json_uint(struct json *j, const char *key, unsigned long v)
+{
+	json_key(j, key);
+	fprintf(j->f, "%lu", v);
+}
+
+void json_bool(struct json *j, const char *key, int v)
+{
+	json_key(j, key);
+	fputs(v ? "true" : "false", j->f);
+}
+
+void json_null(struct json *j, const char *key)
+{
+	json_key(j, key);
+	fputs("null", j->f);
+}
+
+void json_hex(struct json *j, const char *key, const unsigned char *buf, size_t len)
+{
+	size_t i;
+
+	json_key(j, key);
+	putc('"', j->f);
+	for (i = 0; i < len; i++)
+		fprintf(j->f, "%02x", buf[i]);
+	putc('"', j->f);
+}
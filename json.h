@@ -0,0 +1,51 @@
+/*****************************************************************************/
+
+/*
+ *      json.h  --  streaming JSON writer
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifndef _JSON_H
+#define _JSON_H
+
+#include <stdio.h>
+
+#define JSON_MAX_DEPTH	64
+
+/*
+ * Values go straight to the stream as they are produced; the writer
+ * only remembers, per open object or array, whether it needs a comma.
+ * Inside an object every value has a key, inside an array key is NULL.
+ */
+struct json {
+	FILE *f;
+	unsigned int depth;
+	unsigned char empty[JSON_MAX_DEPTH];
+};
+
+extern void json_init(struct json *j, FILE *f);
+extern void json_object_begin(struct json *j, const char *key);
+extern void json_object_end(struct json *j);
+extern void json_array_begin(struct json *j, const char *key);
+extern void json_array_end(struct json *j);
+extern void json_string(struct json *j, const char *key, const char *s);
+extern void json_uint(struct json *j, const char *key, unsigned long v);
+extern void json_bool(struct json *j, const char *key, int v);
+extern void json_null(struct json *j, const char *key);
+extern void json_hex(struct json *j, const char *key, const unsigned char *buf, size_t len);
+
+/* ---------------------------------------------------------------------- */
+#endif /* _JSON_H */
@@ -0,0 +1,278 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-bench.c  --  what one command costs, for make bench
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#ifdef OS_LINUX
+#include <sys/ptrace.h>
+#endif
+
+/*
+ * lsusb-bench [-n runs] [-a counter.so] command [args...]
+ *
+ * Runs the command a number of times with its output thrown away and
+ * prints one line of tab separated numbers: the median wall, user and
+ * system time in milliseconds, the largest peak RSS in kB, the number of
+ * system calls, the number of allocations and the bytes allocated, and
+ * the exit status.  System calls are counted in one more run under
+ * ptrace, allocations in another with counter.so (bench-malloc.so)
+ * preloaded, so neither slows down the timed runs.  A number that could
+ * not be had is printed as "-".
+ */
+
+#define BENCH_MAXRUNS	101
+
+struct bench_run {
+	double wall, user, sys;
+	long maxrss;
+	int status;
+};
+
+/* ---------------------------------------------------------------------- */
+
+static double tv_ms(const struct timeval *tv)
+{
+	return tv->tv_sec * 1e3 + tv->tv_usec / 1e3;
+}
+
+static double now_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void quiet(void)
+{
+	int fd = open("/dev/null", O_RDWR);
+
+	if (fd >= 0) {
+		dup2(fd, STDOUT_FILENO);
+		dup2(fd, STDERR_FILENO);
+		if (fd > STDERR_FILENO)
+			close(fd);
+	}
+}
+
+static int run_once(char **argv, struct bench_run *r)
+{
+	struct rusage ru;
+	double start = now_ms();
+	int status;
+	pid_t pid;
+
+	pid = fork();
+	if (pid < 0)
+		return -1;
+	if (pid == 0) {
+		quiet();
+		execvp(argv[0], argv);
+		_exit(127);
+	}
+	if (wait4(pid, &status, 0, &ru) < 0)
+		return -1;
+	r->wall = now_ms() - start;
+	r->user = tv_ms(&ru.ru_utime);
+	r->sys = tv_ms(&ru.ru_stime);
+	r->maxrss = ru.ru_maxrss;
+	r->status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+	return 0;
+}
+
+#ifdef OS_LINUX
+/* every entry into the kernel, counted at the stops ptrace makes there */
+static long count_syscalls(char **argv)
+{
+	long stops = 0;
+	int status, sig;
+	pid_t pid;
+
+	pid = fork();
+	if (pid < 0)
+		return -1;
+	if (pid == 0) {
+		quiet();
+		if (ptrace(PTRACE_TRACEME, 0, NULL, NULL) < 0)
+			_exit(127);
+		execvp(argv[0], argv);
+		_exit(127);
+	}
+	/* stopped at the exec */
+	if (waitpid(pid, &status, 0) < 0 || !WIFSTOPPED(status))
+		return -1;
+	ptrace(PTRACE_SETOPTIONS, pid, NULL,
+	       (void *)(PTRACE_O_TRACESYSGOOD | PTRACE_O_TRACEEXEC | PTRACE_O_EXITKILL));
+	sig = 0;
+	for (;;) {
+		if (ptrace(PTRACE_SYSCALL, pid, NULL, (void *)(long)sig) < 0)
+			break;
+		if (waitpid(pid, &status, 0) < 0)
+			break;
+		if (WIFEXITED(status) || WIFSIGNALED(status))
+			return (stops + 1) / 2;
+		sig = 0;
+		if (WSTOPSIG(status) == (SIGTRAP | 0x80))
+			stops++;
+		else if (status >> 16 == 0)	/* not a ptrace event, pass it on */
+			sig = WSTOPSIG(status);
+	}
+	kill(pid, SIGKILL);
+	waitpid(pid, &status, 0);
+	return -1;
+}
+#else
+static long count_syscalls(char **argv)
+{
+	return -1;
+}
+#endif
+
+/* the counter reports "allocations bytes" on the fd in LSUSB_BENCH_FD */
+static int count_allocs(char **argv, const char *counter,
+			unsigned long *allocs, unsigned long long *bytes)
+{
+	char buf[64];
+	int fds[2], status, ok = 0;
+	ssize_t r;
+	pid_t pid;
+
+	if (pipe(fds) < 0)
+		return -1;
+	pid = fork();
+	if (pid < 0) {
+		close(fds[0]);
+		close(fds[1]);
+		return -1;
+	}
+	if (pid == 0) {
+		close(fds[0]);
+		quiet();
+		snprintf(buf, sizeof(buf), "%d", fds[1]);
+		setenv("LSUSB_BENCH_FD", buf, 1);
+		setenv("LD_PRELOAD", counter, 1);
+		execvp(argv[0], argv);
+		_exit(127);
+	}
+	close(fds[1]);
+	r = read(fds[0], buf, sizeof(buf) - 1);
+	close(fds[0]);
+	waitpid(pid, &status, 0);
+	if (r > 0) {
+		buf[r] = '\0';
+		ok = sscanf(buf, "%lu %llu", allocs, bytes) == 2;
+	}
+	return ok ? 0 : -1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+static int cmp_double(const void *a, const void *b)
+{
+	double da = *(const double *)a, db = *(const double *)b;
+
+	return da < db ? -1 : da > db;
+}
+
+static double median(struct bench_run *runs, int n, size_t offset)
+{
+	double v[BENCH_MAXRUNS];
+	int i;
+
+	for (i = 0; i < n; i++)
+		v[i] = *(double *)((char *)&runs[i] + offset);
+	qsort(v, n, sizeof(v[0]), cmp_double);
+	return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+int main(int argc, char *argv[])
+{
+	struct bench_run runs[BENCH_MAXRUNS];
+	const char *counter = NULL;
+	unsigned long allocs;
+	unsigned long long bytes;
+	long maxrss = 0, syscalls;
+	int nruns = 5, i, c, status = 0;
+	char *cp;
+
+	while ((c = getopt(argc, argv, "+n:a:")) != -1) {
+		switch (c) {
+		case 'n':
+			nruns = strtol(optarg, &cp, 10);
+			if (*cp || nruns < 1 || nruns > BENCH_MAXRUNS)
+				goto usage;
+			break;
+		case 'a':
+			counter = optarg;
+			break;
+		default:
+			goto usage;
+		}
+	}
+	if (optind >= argc)
+		goto usage;
+	argv += optind;
+
+	for (i = 0; i < nruns; i++) {
+		if (run_once(argv, &runs[i]) < 0) {
+			fprintf(stderr, "lsusb-bench: %s: %s\n", argv[0], strerror(errno));
+			return 1;
+		}
+		if (runs[i].maxrss > maxrss)
+			maxrss = runs[i].maxrss;
+		if (runs[i].status)
+			status = runs[i].status;
+	}
+	syscalls = count_syscalls(argv);
+
+	printf("%.3f\t%.3f\t%.3f\t%ld\t",
+	       median(runs, nruns, offsetof(struct bench_run, wall)),
+	       median(runs, nruns, offsetof(struct bench_run, user)),
+	       median(runs, nruns, offsetof(struct bench_run, sys)), maxrss);
+	if (syscalls >= 0)
+		printf("%ld\t", syscalls);
+	else
+		printf("-\t");
+	if (counter && count_allocs(argv, counter, &allocs, &bytes) == 0)
+		printf("%lu\t%llu\t", allocs, bytes);
+	else
+		printf("-\t-\t");
+	printf("%d\n", status);
+	return 0;
+
+usage:
+	fprintf(stderr, "Usage: lsusb-bench [-n runs] [-a counter.so] command [args...]\n");
+	return 2;
+}
@@ -0,0 +1,499 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-devices.c  --  the usb-devices report, without the shell
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <dirent.h>
+#include <locale.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "lsusb.h"
+#include "usbmisc.h"
+
+#ifdef OS_LINUX
+
+/*
+ * lsusb --devices prints what the usb-devices script does, byte for byte,
+ * but reads sysfs itself instead of running cat once per attribute.  Each
+ * device directory is opened once; its attributes are read relative to
+ * it and one listing of it gives both its interfaces and its children.
+ *
+ * Output matching the script means matching the shell too: an attribute
+ * is its file with the trailing newlines dropped, split into words unless
+ * the script quotes it, and the words go through printf's rules, where a
+ * missing word prints as nothing or 0, a number is read like strtol with
+ * base 0 and leftover words run the format again.  Missing files read as
+ * empty, and globs are walked in the order the shell sorts them, which
+ * is the collation order of the locale in LC_COLLATE, LC_ALL or LANG.
+ */
+
+#define DEVICES_ATTR_MAX	4096
+#define DEVICES_MAXWORDS	32
+
+struct sh_words {
+	const char *word[DEVICES_MAXWORDS];
+	unsigned int n;
+	char buf[4 * DEVICES_ATTR_MAX];
+	size_t used;
+};
+
+struct name_list {
+	char **names;
+	unsigned int n, size;
+};
+
+/* one line's words at a time, for the whole walk */
+static struct sh_words words;
+
+/* ---------------------------------------------------------------------- */
+
+/* `cat name`, with a missing file read as empty */
+static char *read_attr(int dirfd, const char *name, char *buf, size_t size)
+{
+	ssize_t r, i, len = 0;
+	int fd;
+
+	fd = openat(dirfd, name, O_RDONLY | O_CLOEXEC);
+	if (fd >= 0) {
+		while (len < (ssize_t)size - 1 &&
+		       (r = read(fd, buf + len, size - 1 - len)) > 0)
+			len += r;
+		close(fd);
+	}
+	/* the shell drops NUL bytes and trailing newlines */
+	for (r = i = 0; r < len; r++)
+		if (buf[r])
+			buf[i++] = buf[r];
+	len = i;
+	while (len > 0 && buf[len - 1] == '\n')
+		len--;
+	buf[len] = '\0';
+	return buf;
+}
+
+static void words_clear(struct sh_words *w)
+{
+	w->n = 0;
+	w->used = 0;
+}
+
+/* "$value" */
+static void words_quoted(struct sh_words *w, const char *value)
+{
+	size_t len = strlen(value) + 1;
+
+	if (w->n >= DEVICES_MAXWORDS || w->used + len > sizeof(w->buf))
+		return;
+	w->word[w->n++] = memcpy(w->buf + w->used, value, len);
+	w->used += len;
+}
+
+/* $value, split at blanks and newlines */
+static void words_split(struct sh_words *w, const char *value)
+{
+	char word[DEVICES_ATTR_MAX];
+	size_t len;
+
+	for (;;) {
+		value += strspn(value, " \t\n");
+		if (!*value)
+			break;
+		len = strcspn(value, " \t\n");
+		if (len >= sizeof(word))
+			len = sizeof(word) - 1;
+		memcpy(word, value, len);
+		word[len] = '\0';
+		words_quoted(w, word);
+		value += strcspn(value, " \t\n");
+	}
+}
+
+static void words_attr(struct sh_words *w, int dirfd, const char *name)
+{
+	char buf[DEVICES_ATTR_MAX];
+
+	words_split(w, read_attr(dirfd, name, buf, sizeof(buf)));
+}
+
+/* the shell's printf, for the %s, %i and flags the report uses */
+static void sh_printf(const char *fmt, const struct sh_words *w)
+{
+	char spec[32];
+	const char *p, *arg;
+	unsigned int next = 0, first;
+	int left, zero, width;
+
+	do {
+		first = next;
+		for (p = fmt; *p; p++) {
+			if (*p != '%') {
+				putchar(*p);
+				continue;
+			}
+			left = zero = width = 0;
+			for (p++; *p == '-' || *p == '0'; p++) {
+				if (*p == '-')
+					left = 1;
+				else
+					zero = 1;
+			}
+			for (; *p >= '0' && *p <= '9'; p++)
+				width = width * 10 + *p - '0';
+			arg = next < w->n ? w->word[next++] : NULL;
+			if (*p == 's') {
+				snprintf(spec, sizeof(spec), "%%%s%ds", left ? "-" : "", width);
+				printf(spec, arg ? arg : "");
+			} else {
+				snprintf(spec, sizeof(spec), "%%%s%s%dlld", left ? "-" : "",
+					 zero ? "0" : "", width);
+				printf(spec, arg ? strtoll(arg, NULL, 0) : 0LL);
+			}
+			if (!*p)
+				break;
+		}
+	} while (next < w->n && next > first);
+}
+
+static const char *class_decode(const char *class)
+{
+	static const struct {
+		const char *class, *name;
+	} classes[] = {
+		{ "00", ">ifc " }, { "01", "audio" }, { "02", "commc" },
+		{ "03", "HID  " }, { "05", "PID  " }, { "06", "still" },
+		{ "07", "print" }, { "08", "stor." }, { "09", "hub  " },
+		{ "0a", "data " }, { "0b", "scard" }, { "0d", "c-sec" },
+		{ "0e", "video" }, { "0f", "perhc" }, { "dc", "diagd" },
+		{ "e0", "wlcon" }, { "ef", "misc " }, { "fe", "app. " },
+		{ "ff", "vend." },
+		/* the script's catch-all only matches a literal "*" */
+		{ "*", "unk. " },
+	};
+	unsigned int i;
+
+	for (i = 0; i < sizeof(classes) / sizeof(classes[0]); i++)
+		if (!strcmp(class, classes[i].class))
+			return classes[i].name;
+	return "";
+}
+
+/* ---------------------------------------------------------------------- */
+
+/* bash sorts glob matches with strcoll(), bytewise where that ties */
+static int cmp_names(const void *a, const void *b)
+{
+	const char *na = *(char * const *)a, *nb = *(char * const *)b;
+	int r = strcoll(na, nb);
+
+	return r ? r : strcmp(na, nb);
+}
+
+/* the entries of a directory matching pattern, as the shell globs them */
+static int list_dir(int dirfd, const char *pattern, struct name_list *l)
+{
+	struct dirent *de;
+	char **names;
+	DIR *dir;
+	int fd;
+
+	l->n = 0;
+	fd = dup(dirfd);
+	if (fd < 0)
+		return -1;
+	dir = fdopendir(fd);
+	if (!dir) {
+		close(fd);
+		return -1;
+	}
+	rewinddir(dir);
+	while ((de = readdir(dir))) {
+		if (de->d_name[0] == '.' || fnmatch(pattern, de->d_name, 0))
+			continue;
+		if (l->n == l->size) {
+			names = realloc(l->names, (l->size * 2 + 16) * sizeof(*names));
+			if (!names)
+				break;
+			l->names = names;
+			l->size = l->size * 2 + 16;
+		}
+		l->names[l->n] = strdup(de->d_name);
+		if (l->names[l->n])
+			l->n++;
+	}
+	closedir(dir);
+	qsort(l->names, l->n, sizeof(l->names[0]), cmp_names);
+	return 0;
+}
+
+static void list_free(struct name_list *l)
+{
+	while (l->n)
+		free(l->names[--l->n]);
+	free(l->names);
+}
+
+/* "B-P[.P]...", a device rather than an interface */
+static int is_child_name(const char *name, const char *busnum)
+{
+	size_t len = strlen(busnum);
+	const char *p;
+
+	if (strncmp(name, busnum, len) || name[len] != '-')
+		return 0;
+	for (p = name + len + 1;; p++) {
+		if (*p < '0' || *p > '9')
+			return 0;
+		while (p[1] >= '0' && p[1] <= '9')
+			p++;
+		if (!p[1])
+			return 1;
+		if (*++p != '.')
+			return 0;
+	}
+}
+
+/* ---------------------------------------------------------------------- */
+
+static void print_endpoint(int epfd)
+{
+	char buf[DEVICES_ATTR_MAX], maxps[32];
+	struct sh_words *w = &words;
+	unsigned long size;
+
+	words_clear(w);
+	size = strtoul(read_attr(epfd, "wMaxPacketSize", buf, sizeof(buf)), NULL, 16);
+	snprintf(maxps, sizeof(maxps), "%4lu*%lu", size & 0x7ff, 1 + ((size >> 11) & 3));
+	words_attr(w, epfd, "bEndpointAddress");
+	words_attr(w, epfd, "direction");
+	words_attr(w, epfd, "bmAttributes");
+	words_attr(w, epfd, "type");
+	words_quoted(w, maxps);
+	words_attr(w, epfd, "interval");
+	sh_printf("E:  Ad=%s(%s) Atr=%s(%s) MxPS=%s Ivl=%s\n", w);
+}
+
+/* ${value#0} */
+static void words_strip0(struct sh_words *w, int dirfd, const char *name)
+{
+	char buf[DEVICES_ATTR_MAX];
+
+	read_attr(dirfd, name, buf, sizeof(buf));
+	words_split(w, buf[0] == '0' ? buf + 1 : buf);
+}
+
+/* an interface that is not there prints as a line of blanks, like the script's */
+static void print_interface(int devfd, const char *name)
+{
+	char buf[DEVICES_ATTR_MAX], class[DEVICES_ATTR_MAX], *driver;
+	struct sh_words *w = &words;
+	struct name_list eps = { NULL, 0, 0 };
+	struct stat st;
+	unsigned int i;
+	ssize_t len;
+	int fd, epfd;
+
+	words_clear(w);
+	fd = openat(devfd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	words_strip0(w, fd, "bInterfaceNumber");
+	words_strip0(w, fd, "bAlternateSetting");
+	words_strip0(w, fd, "bNumEndpoints");
+	/* class_decode $class sees the first word */
+	read_attr(fd, "bInterfaceClass", buf, sizeof(buf));
+	words_split(w, buf);
+	class[0] = '\0';
+	sscanf(buf, "%4095s", class);
+	words_quoted(w, class_decode(class));
+	words_attr(w, fd, "bInterfaceSubClass");
+	words_attr(w, fd, "bInterfaceProtocol");
+	len = fd >= 0 ? readlinkat(fd, "driver", buf, sizeof(buf) - 1) : -1;
+	if (len > 0) {
+		buf[len] = '\0';
+		driver = strrchr(buf, '/');
+		words_split(w, driver ? driver + 1 : buf);
+	} else {
+		words_quoted(w, "(none)");
+	}
+	sh_printf("I:  If#=%2i Alt=%2i #EPs=%2i Cls=%s(%s) Sub=%s Prot=%s Driver=%s\n", w);
+
+	if (fd < 0)
+		return;
+	list_dir(fd, "ep_??", &eps);
+	for (i = 0; i < eps.n; i++) {
+		/* the script only follows links here */
+		if (fstatat(fd, eps.names[i], &st, AT_SYMLINK_NOFOLLOW) < 0 ||
+		    !S_ISLNK(st.st_mode))
+			continue;
+		epfd = openat(fd, eps.names[i], O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		print_endpoint(epfd);
+		if (epfd >= 0)
+			close(epfd);
+	}
+	list_free(&eps);
+	close(fd);
+}
+
+static void print_string(int devfd, const char *file, const char *name)
+{
+	char buf[DEVICES_ATTR_MAX];
+	struct stat st;
+
+	if (fstatat(devfd, file, &st, 0) < 0 || !S_ISREG(st.st_mode))
+		return;
+	printf("S:  %s=%s\n", name, read_attr(devfd, file, buf, sizeof(buf)));
+}
+
+static void print_device(int parentfd, const char *name, const char *parent,
+			 int level, int count)
+{
+	char busnum[DEVICES_ATTR_MAX], devnum[DEVICES_ATTR_MAX];
+	char buf[DEVICES_ATTR_MAX], class[DEVICES_ATTR_MAX], num[24], rev[3];
+	char pattern[DEVICES_ATTR_MAX + 8];
+	struct name_list entries = { NULL, 0, 0 };
+	struct sh_words *w = &words;
+	unsigned int i, nintfs;
+	const char *p;
+	int fd, devcount;
+
+	fd = openat(parentfd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+	read_attr(fd, "busnum", busnum, sizeof(busnum));
+	read_attr(fd, "devnum", devnum, sizeof(devnum));
+
+	words_clear(w);
+	words_split(w, busnum);
+	snprintf(num, sizeof(num), "%d", level);
+	words_quoted(w, num);
+	words_split(w, parent);
+	/* ${devpath##*[-.]} - 1 */
+	p = name + strlen(name);
+	while (p > name && p[-1] != '-' && p[-1] != '.')
+		p--;
+	snprintf(num, sizeof(num), "%lld", level > 0 ? strtoll(p, NULL, 0) - 1 : 0);
+	words_quoted(w, num);
+	snprintf(num, sizeof(num), "%d", count);
+	words_quoted(w, num);
+	words_split(w, devnum);
+	words_attr(w, fd, "speed");
+	words_attr(w, fd, "maxchild");
+	sh_printf("\nT:  Bus=%02i Lev=%02i Prnt=%02i Port=%02i Cnt=%02i Dev#=%3i Spd=%-3s MxCh=%2i\n", w);
+
+	words_clear(w);
+	words_attr(w, fd, "version");
+	read_attr(fd, "bDeviceClass", buf, sizeof(buf));
+	words_split(w, buf);
+	class[0] = '\0';
+	sscanf(buf, "%4095s", class);
+	words_quoted(w, class_decode(class));
+	words_attr(w, fd, "bDeviceSubClass");
+	words_attr(w, fd, "bDeviceProtocol");
+	words_attr(w, fd, "bMaxPacketSize0");
+	words_attr(w, fd, "bNumConfigurations");
+	sh_printf("D:  Ver=%5s Cls=%s(%s) Sub=%s Prot=%s MxPS=%2i #Cfgs=%3i\n", w);
+
+	words_clear(w);
+	words_attr(w, fd, "idVendor");
+	words_attr(w, fd, "idProduct");
+	/* cut -c 1-2 and 3-4 of the first line */
+	read_attr(fd, "bcdDevice", buf, sizeof(buf));
+	buf[strcspn(buf, "\n")] = '\0';
+	snprintf(rev, sizeof(rev), "%.2s", buf);
+	words_split(w, rev);
+	snprintf(rev, sizeof(rev), "%.2s", buf + strnlen(buf, 2));
+	words_split(w, rev);
+	sh_printf("P:  Vendor=%s ProdID=%s Rev=%s.%s\n", w);
+
+	print_string(fd, "manufacturer", "Manufacturer");
+	print_string(fd, "product", "Product");
+	print_string(fd, "serial", "SerialNumber");
+
+	words_clear(w);
+	words_attr(w, fd, "bNumInterfaces");
+	words_attr(w, fd, "bConfigurationValue");
+	words_attr(w, fd, "bmAttributes");
+	words_attr(w, fd, "bMaxPower");
+	sh_printf("C:  #Ifs=%2i Cfg#=%2i Atr=%s MxPwr=%s\n", w);
+
+	/* one listing for "$busnum-*:?.*" and "$busnum-*" */
+	snprintf(pattern, sizeof(pattern), "%s-*", busnum);
+	list_dir(fd, pattern, &entries);
+	snprintf(pattern, sizeof(pattern), "%s-*:?.*", busnum);
+	for (i = nintfs = 0; i < entries.n; i++) {
+		if (fnmatch(pattern, entries.names[i], 0))
+			continue;
+		print_interface(fd, entries.names[i]);
+		nintfs++;
+	}
+	/* an unmatched glob is left as it is */
+	if (!nintfs)
+		print_interface(fd, pattern);
+
+	devcount = 0;
+	for (i = 0; i < entries.n; i++) {
+		if (!is_child_name(entries.names[i], busnum))
+			continue;
+		print_device(fd, entries.names[i], devnum, level + 1, ++devcount);
+	}
+	list_free(&entries);
+	close(fd);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int lsusb_devices(void)
+{
+	const char *path = sysfs_devices_path();
+	struct name_list roots = { NULL, 0, 0 };
+	char bus[MY_PATH_MAX];
+	struct stat st;
+	unsigned int i;
+	int fd;
+
+	/* lsusb only sets LC_CTYPE; the shell sorts by the caller's locale */
+	setlocale(LC_COLLATE, "");
+
+	/* "/sys/bus" of the sysfs in use */
+	snprintf(bus, sizeof(bus), "%.*s", (int)(strlen(path) - strlen("usb/devices/") - 1), path);
+	if (stat(bus, &st) < 0 || !S_ISDIR(st.st_mode)) {
+		fprintf(stderr, "Error: directory %s does not exist; is sysfs mounted?\n", bus);
+		return EXIT_FAILURE;
+	}
+	fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (fd >= 0) {
+		list_dir(fd, "usb*", &roots);
+		for (i = 0; i < roots.n; i++)
+			print_device(fd, roots.names[i], "0", 0, 0);
+		list_free(&roots);
+		close(fd);
+	}
+	return EXIT_SUCCESS;
+}
+
+#endif /* OS_LINUX */
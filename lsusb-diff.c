@@ -0,0 +1,400 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-diff.c  --  compare two snapshots, or one with the bus
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libusb.h>
+
+#include "lsusb.h"
+#include "names.h"
+#include "snapshot.h"
+
+/*
+ * Devices are paired up in two passes.  A device whose serial number,
+ * together with its vendor and product ID, is unique on both sides is
+ * the same device wherever it is plugged in.  The rest are paired by
+ * location when vendor and product ID agree there.  Whatever is left
+ * over was removed or added.  Both passes use hash tables, so the whole
+ * comparison is linear in the number of devices.
+ */
+
+struct diff_side {
+	struct snapshot *s;
+	struct snapshot_device *devs;
+	unsigned int ndevs;
+	int *peer;		/* index on the other side, -1 if unpaired */
+	unsigned int *serial_hash;
+	int *serial_unique;
+	int *by_serial;		/* open addressing, -1 for empty */
+	int *by_location;
+	unsigned int mask;
+};
+
+/* ---------------------------------------------------------------------- */
+
+static unsigned int hash_serial(const struct snapshot_device *d)
+{
+	const unsigned char *p = (const unsigned char *)d->serial;
+	unsigned int h = 2166136261u;	/* FNV-1a */
+
+	h = (h ^ (d->desc.idVendor & 0xff)) * 16777619u;
+	h = (h ^ (d->desc.idVendor >> 8)) * 16777619u;
+	h = (h ^ (d->desc.idProduct & 0xff)) * 16777619u;
+	h = (h ^ (d->desc.idProduct >> 8)) * 16777619u;
+	while (*p)
+		h = (h ^ *p++) * 16777619u;
+	return h;
+}
+
+static unsigned int hash_location(unsigned int location_id)
+{
+	return location_id * 2654435761u;
+}
+
+static int same_serial(const struct snapshot_device *a, const struct snapshot_device *b)
+{
+	return a->desc.idVendor == b->desc.idVendor &&
+	       a->desc.idProduct == b->desc.idProduct &&
+	       !strcmp(a->serial, b->serial);
+}
+
+/* the device on side with the same serial key as d, -1 if none */
+static int find_serial(const struct diff_side *side, const struct snapshot_device *d,
+		       unsigned int h)
+{
+	unsigned int slot;
+	int i;
+
+	for (slot = h & side->mask; (i = side->by_serial[slot]) >= 0;
+	     slot = (slot + 1) & side->mask)
+		if (side->serial_hash[i] == h && same_serial(&side->devs[i], d))
+			return i;
+	return -1;
+}
+
+static int find_location(const struct diff_side *side, unsigned int location_id)
+{
+	unsigned int slot;
+	int i;
+
+	for (slot = hash_location(location_id) & side->mask;
+	     (i = side->by_location[slot]) >= 0; slot = (slot + 1) & side->mask)
+		if (side->devs[i].location_id == location_id)
+			return i;
+	return -1;
+}
+
+static int side_init(struct diff_side *side, struct snapshot *s)
+{
+	unsigned int i, size, slot;
+	int j;
+
+	side->s = s;
+	side->ndevs = snapshot_ndevices(s);
+	for (size = 16; size < 2 * side->ndevs; size <<= 1)
+		;
+	side->mask = size - 1;
+	side->devs = calloc(side->ndevs + 1, sizeof(*side->devs));
+	side->peer = calloc(side->ndevs + 1, sizeof(*side->peer));
+	side->serial_hash = calloc(side->ndevs + 1, sizeof(*side->serial_hash));
+	side->serial_unique = calloc(side->ndevs + 1, sizeof(*side->serial_unique));
+	side->by_serial = malloc(size * sizeof(*side->by_serial));
+	side->by_location = malloc(size * sizeof(*side->by_location));
+	if (!side->devs || !side->peer || !side->serial_hash || !side->serial_unique ||
+	    !side->by_serial || !side->by_location) {
+		fprintf(stderr, "out of memory\n");
+		return -1;
+	}
+	memset(side->by_serial, 0xff, size * sizeof(*side->by_serial));
+	memset(side->by_location, 0xff, size * sizeof(*side->by_location));
+
+	for (i = 0; i < side->ndevs; i++) {
+		struct snapshot_device *d = &side->devs[i];
+
+		snapshot_device(s, i, d);
+		side->peer[i] = -1;
+
+		if (find_location(side, d->location_id) < 0) {
+			for (slot = hash_location(d->location_id) & side->mask;
+			     side->by_location[slot] >= 0; slot = (slot + 1) & side->mask)
+				;
+			side->by_location[slot] = i;
+		}
+
+		if (!d->serial || !*d->serial)
+			continue;
+		side->serial_hash[i] = hash_serial(d);
+		j = find_serial(side, d, side->serial_hash[i]);
+		if (j >= 0) {
+			/* two of them, so the serial number tells nothing */
+			side->serial_unique[j] = 0;
+			continue;
+		}
+		side->serial_unique[i] = 1;
+		for (slot = side->serial_hash[i] & side->mask;
+		     side->by_serial[slot] >= 0; slot = (slot + 1) & side->mask)
+			;
+		side->by_serial[slot] = i;
+	}
+	return 0;
+}
+
+static void side_free(struct diff_side *side)
+{
+	free(side->devs);
+	free(side->peer);
+	free(side->serial_hash);
+	free(side->serial_unique);
+	free(side->by_serial);
+	free(side->by_location);
+	snapshot_close(side->s);
+}
+
+static void pair_devices(struct diff_side *old, struct diff_side *new)
+{
+	unsigned int i;
+	int j;
+
+	for (i = 0; i < new->ndevs; i++) {
+		if (!new->serial_unique[i])
+			continue;
+		j = find_serial(old, &new->devs[i], new->serial_hash[i]);
+		if (j < 0 || !old->serial_unique[j])
+			continue;
+		new->peer[i] = j;
+		old->peer[j] = i;
+	}
+
+	for (i = 0; i < new->ndevs; i++) {
+		if (new->peer[i] >= 0)
+			continue;
+		j = find_location(old, new->devs[i].location_id);
+		if (j < 0 || old->peer[j] >= 0 ||
+		    old->devs[j].desc.idVendor != new->devs[i].desc.idVendor ||
+		    old->devs[j].desc.idProduct != new->devs[i].desc.idProduct)
+			continue;
+		new->peer[i] = j;
+		old->peer[j] = i;
+	}
+}
+
+/* ---------------------------------------------------------------------- */
+
+static const char *port_path(const struct snapshot_device *d, char *buf, size_t size)
+{
+	unsigned int i;
+	size_t len;
+
+	if (!d->nports) {
+		snprintf(buf, size, "usb%u", d->busnum);
+		return buf;
+	}
+	len = snprintf(buf, size, "%u", d->busnum);
+	for (i = 0; i < d->nports && len < size; i++)
+		len += snprintf(buf + len, size - len, "%c%u", i ? '.' : '-', d->ports[i]);
+	return buf;
+}
+
+static const char *speed_name(int speed)
+{
+	switch (speed) {
+	case LIBUSB_SPEED_LOW:		return "1.5";
+	case LIBUSB_SPEED_FULL:		return "12";
+	case LIBUSB_SPEED_HIGH:		return "480";
+	case LIBUSB_SPEED_SUPER:	return "5000";
+	default:			return "unknown";
+	}
+}
+
+static void print_presence(const char *what, const struct snapshot_device *d)
+{
+	const char *vendor = names_vendor(d->desc.idVendor);
+	const char *product = names_product(d->desc.idVendor, d->desc.idProduct);
+	char path[64];
+
+	printf("%s %s %04x:%04x%s%s%s%s\n", what, port_path(d, path, sizeof(path)),
+	       d->desc.idVendor, d->desc.idProduct,
+	       vendor ? " " : "", vendor ? vendor : "",
+	       product ? " " : "", product ? product : "");
+}
+
+/* interface drivers of device i, by interface number */
+static void get_drivers(const struct snapshot *s, unsigned int i, const char **drivers)
+{
+	const char *name;
+	unsigned int k;
+	int ifnum;
+
+	memset(drivers, 0, 256 * sizeof(*drivers));
+	for (k = 0; (name = snapshot_driver(s, i, k, &ifnum)); k++)
+		if (ifnum >= 0 && ifnum < 256)
+			drivers[ifnum] = name;
+}
+
+#define DIFF_FIELD(field, fmt)						\
+	do {								\
+		if (a->desc.field != b->desc.field) {			\
+			printf("changed %s %s " #field " " fmt " -> " fmt "\n", \
+			       path, id, a->desc.field, b->desc.field);	\
+			changes++;					\
+		}							\
+	} while (0)
+
+#define DIFF_BCD(field)							\
+	do {								\
+		if (a->desc.field != b->desc.field) {			\
+			printf("changed %s %s " #field " %x.%02x -> %x.%02x\n", \
+			       path, id, a->desc.field >> 8, a->desc.field & 0xff, \
+			       b->desc.field >> 8, b->desc.field & 0xff); \
+			changes++;					\
+		}							\
+	} while (0)
+
+/* what changed about one device, returns the number of lines printed */
+static int diff_device(const struct diff_side *old, unsigned int oi,
+		       const struct diff_side *new, unsigned int ni)
+{
+	const struct snapshot_device *a = &old->devs[oi], *b = &new->devs[ni];
+	const char *adrv[256], *bdrv[256];
+	const unsigned char *adata, *bdata;
+	unsigned int alen, blen, n;
+	char path[64], oldpath[64], id[16];
+	int i, aret, bret;
+	int changes = 0;
+
+	port_path(b, path, sizeof(path));
+	snprintf(id, sizeof(id), "%04x:%04x", b->desc.idVendor, b->desc.idProduct);
+
+	if (a->location_id != b->location_id) {
+		printf("moved %s %s from %s\n", path, id,
+		       port_path(a, oldpath, sizeof(oldpath)));
+		changes++;
+	}
+	if (a->speed != b->speed) {
+		printf("speed %s %s %s -> %s\n", path, id,
+		       speed_name(a->speed), speed_name(b->speed));
+		changes++;
+	}
+
+	get_drivers(old->s, oi, adrv);
+	get_drivers(new->s, ni, bdrv);
+	for (i = 0; i < 256; i++) {
+		if (adrv[i] == bdrv[i] || (adrv[i] && bdrv[i] && !strcmp(adrv[i], bdrv[i])))
+			continue;
+		printf("driver %s %s interface %d: %s -> %s\n", path, id, i,
+		       adrv[i] ? adrv[i] : "none", bdrv[i] ? bdrv[i] : "none");
+		changes++;
+	}
+
+	DIFF_BCD(bcdUSB);
+	DIFF_FIELD(bDeviceClass, "%u");
+	DIFF_FIELD(bDeviceSubClass, "%u");
+	DIFF_FIELD(bDeviceProtocol, "%u");
+	DIFF_FIELD(bMaxPacketSize0, "%u");
+	DIFF_BCD(bcdDevice);
+	DIFF_FIELD(iManufacturer, "%u");
+	DIFF_FIELD(iProduct, "%u");
+	DIFF_FIELD(iSerialNumber, "%u");
+	DIFF_FIELD(bNumConfigurations, "%u");
+
+	/* those both sides have; the count itself was compared above */
+	n = a->nconfigs < b->nconfigs ? a->nconfigs : b->nconfigs;
+	for (i = 0; i < (int)n; i++) {
+		aret = snapshot_config(old->s, oi, i, &adata, &alen);
+		bret = snapshot_config(new->s, ni, i, &bdata, &blen);
+		if (aret == bret && alen == blen && (!alen || !memcmp(adata, bdata, alen)))
+			continue;
+		printf("changed %s %s configuration %d\n", path, id, i);
+		changes++;
+	}
+	return changes;
+}
+
+#undef DIFF_FIELD
+#undef DIFF_BCD
+
+/* ---------------------------------------------------------------------- */
+
+static struct snapshot *take_live(libusb_context *ctx)
+{
+	struct usbmodel model;
+	struct snapshot *s;
+
+	if (usbmodel_build(&model, ctx) < 0)
+		return NULL;
+	s = snapshot_take(&model);
+	usbmodel_free(&model);
+	return s;
+}
+
+/*
+ * Like diff(1), returns 0 if nothing changed, 1 if something did and 2 if
+ * the comparison could not be made.  Without newpath, oldpath is compared
+ * with the devices attached now.
+ */
+int lsusb_diff(libusb_context *ctx, const char *oldpath, const char *newpath)
+{
+	struct diff_side old, new;
+	struct snapshot *s;
+	unsigned int i;
+	int changes = 0, ret = 2;
+
+	memset(&old, 0, sizeof(old));
+	memset(&new, 0, sizeof(new));
+
+	s = snapshot_open(oldpath);
+	if (!s)
+		return 2;
+	if (side_init(&old, s) < 0)
+		goto out;
+	s = newpath ? snapshot_open(newpath) : take_live(ctx);
+	if (!s)
+		goto out;
+	if (side_init(&new, s) < 0)
+		goto out;
+
+	pair_devices(&old, &new);
+
+	for (i = 0; i < old.ndevs; i++) {
+		if (old.peer[i] < 0) {
+			print_presence("removed", &old.devs[i]);
+			changes++;
+		}
+	}
+	for (i = 0; i < new.ndevs; i++) {
+		if (new.peer[i] < 0) {
+			print_presence("added", &new.devs[i]);
+			changes++;
+		} else {
+			changes += diff_device(&old, new.peer[i], &new, i);
+		}
+	}
+	ret = changes ? 1 : 0;
+
+out:
+	side_free(&new);
+	side_free(&old);
+	return ret;
+}
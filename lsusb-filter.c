@@ -0,0 +1,253 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-filter.c  --  device selection for lsusb
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libusb.h>
+
+#include "lsusb.h"
+#include "snapshot.h"
+#include "usbmisc.h"
+
+/*
+ * Every selection option adds a term to the list for its kind.  A device
+ * is shown when, for each kind that has terms, at least one of them
+ * matches: repeating an option widens the selection, combining options
+ * narrows it.  Kinds are checked cheapest first, so most devices are
+ * rejected on their bus and device numbers or the cached device
+ * descriptor, and nothing here ever opens a device or talks to it.
+ */
+
+struct filter_term {
+	struct filter_term *next;
+	int a, b;		/* numbers, -1 for "any" */
+	char *str;
+};
+
+static struct filter_term *filters[FILTER_NKINDS];
+
+/* ---------------------------------------------------------------------- */
+
+static int parse_num(const char *s, int base, int max, int *val)
+{
+	char *end;
+	unsigned long v;
+
+	if (!*s) {
+		*val = -1;
+		return 0;
+	}
+	v = strtoul(s, &end, base);
+	if (*end || v > (unsigned long)max)
+		return -1;
+	*val = v;
+	return 0;
+}
+
+static int parse_speed(const char *s)
+{
+	static const struct {
+		const char *name;
+		int speed;
+	} speeds[] = {
+		{ "1.5", LIBUSB_SPEED_LOW },
+		{ "12", LIBUSB_SPEED_FULL },
+		{ "480", LIBUSB_SPEED_HIGH },
+		{ "5000", LIBUSB_SPEED_SUPER },
+	};
+	unsigned int i;
+
+	for (i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+		if (!strcmp(s, speeds[i].name))
+			return speeds[i].speed;
+	return -1;
+}
+
+int filter_add(enum filter_kind kind, const char *arg)
+{
+	struct filter_term *t, **pp;
+	const char *cp = strchr(arg, ':');
+	char first[16];
+	int r = 0;
+
+	t = calloc(1, sizeof(*t));
+	if (!t)
+		return -1;
+	t->a = t->b = -1;
+
+	switch (kind) {
+	case FILTER_BUSDEV:	/* [[bus]:][devnum], decimal */
+		if (cp && (size_t)(cp - arg) < sizeof(first)) {
+			memcpy(first, arg, cp - arg);
+			first[cp - arg] = 0;
+			r = parse_num(first, 10, 255, &t->a) ||
+				parse_num(cp + 1, 10, 255, &t->b);
+		} else if (cp)
+			r = -1;
+		else
+			r = parse_num(arg, 10, 255, &t->b);
+		break;
+	case FILTER_VENDOR:	/* vendor:[product], hexadecimal */
+		if (cp && (size_t)(cp - arg) < sizeof(first)) {
+			memcpy(first, arg, cp - arg);
+			first[cp - arg] = 0;
+			r = parse_num(first, 16, 0xffff, &t->a) ||
+				parse_num(cp + 1, 16, 0xffff, &t->b);
+		} else
+			r = -1;
+		break;
+	case FILTER_CLASS:
+		r = !*arg || parse_num(arg, 16, 0xff, &t->a);
+		break;
+	case FILTER_SPEED:
+		t->a = parse_speed(arg);
+		r = t->a < 0;
+		break;
+	case FILTER_PATH:
+	case FILTER_SERIAL:
+	case FILTER_DRIVER:
+		t->str = strdup(arg);
+		r = !t->str;
+		break;
+	default:
+		r = -1;
+		break;
+	}
+	if (r) {
+		free(t->str);
+		free(t);
+		return -1;
+	}
+
+	/* keep the order they were given in */
+	for (pp = &filters[kind]; *pp; pp = &(*pp)->next)
+		;
+	*pp = t;
+	return 0;
+}
+
+void filter_free(void)
+{
+	struct filter_term *t;
+	unsigned int k;
+
+	for (k = 0; k < FILTER_NKINDS; k++)
+		while ((t = filters[k])) {
+			filters[k] = t->next;
+			free(t->str);
+			free(t);
+		}
+}
+
+/* ---------------------------------------------------------------------- */
+
+static int match_class(libusb_device *dev, const struct libusb_device_descriptor *desc,
+		       int cls)
+{
+	struct libusb_config_descriptor *config;
+	int i, j, k;
+
+	if (desc->bDeviceClass == cls)
+		return 1;
+	/* the parsed configurations are kept for the dump */
+	for (i = 0; i < desc->bNumConfigurations; i++) {
+		if (get_config(dev, i, &config))
+			continue;
+		for (j = 0; j < config->bNumInterfaces; j++)
+			for (k = 0; k < config->interface[j].num_altsetting; k++)
+				if (config->interface[j].altsetting[k].bInterfaceClass == cls)
+					return 1;
+	}
+	return 0;
+}
+
+#ifdef OS_LINUX
+static int match_driver(libusb_device *dev, const char *driver)
+{
+	struct sysfs_dev *sd = sysfs_dev_get(get_location_id(dev));
+	const char *value = sysfs_dev_attr(sd, SYSFS_BNUMINTERFACES);
+	char buf[MY_PARAM_MAX];
+	int i, n;
+
+	n = value ? (int)strtoul(value, NULL, 10) : 0;
+	if (n < 1)
+		n = 1;
+	for (i = 0; i < n; i++)
+		if (sysfs_dev_driver(sd, i, buf, sizeof(buf)) && !strcmp(buf, driver))
+			return 1;
+	return 0;
+}
+#endif
+
+static int match_term(libusb_device *dev, const struct libusb_device_descriptor *desc,
+		      enum filter_kind kind, const struct filter_term *t)
+{
+	char buf[MY_PATH_MAX];
+
+	switch (kind) {
+	case FILTER_BUSDEV:
+		return (t->a == -1 || t->a == usbdev_get_bus_number(dev)) &&
+			(t->b == -1 || t->b == usbdev_get_device_address(dev));
+	case FILTER_VENDOR:
+		return (t->a == -1 || t->a == desc->idVendor) &&
+			(t->b == -1 || t->b == desc->idProduct);
+	case FILTER_SPEED:
+		return t->a == usbdev_get_device_speed(dev);
+	case FILTER_PATH:
+		get_port_path(dev, buf, sizeof(buf));
+		return !strcmp(buf, t->str);
+	case FILTER_SERIAL:
+		return get_string_from_cache(buf, sizeof(buf), dev,
+					     LIBUSB_DEVICE_S_SERIALNUMBER) > 0 &&
+			!strcmp(buf, t->str);
+	case FILTER_CLASS:
+		return match_class(dev, desc, t->a);
+	case FILTER_DRIVER:
+#ifdef OS_LINUX
+		return match_driver(dev, t->str);
+#else
+		return 0;
+#endif
+	default:
+		return 0;
+	}
+}
+
+int filter_match(libusb_device *dev, const struct libusb_device_descriptor *desc)
+{
+	const struct filter_term *t;
+	unsigned int k;
+
+	for (k = 0; k < FILTER_NKINDS; k++) {
+		if (!filters[k])
+			continue;
+		for (t = filters[k]; t; t = t->next)
+			if (match_term(dev, desc, k, t))
+				break;
+		if (!t)
+			return 0;
+	}
+	return 1;
+}
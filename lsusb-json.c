@@ -0,0 +1,322 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-json.c  --  machine readable output for lsusb
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <libusb.h>
+
+#include "json.h"
+#include "lsusb.h"
+#include "names.h"
+#include "usbmisc.h"
+#include "usbxfer.h"
+
+/*
+ * {"devices":[...]} with one object per device, written as each device
+ * is reached, so memory use does not grow with the number of devices.
+ *
+ * Every descriptor field is given by its USB name and raw value; names
+ * from the ID databases and strings read from the device sit beside
+ * them.  Class specific descriptors (audio, video, HID, CDC, CCID, ...)
+ * are passed through undecoded as "extra", in the order the device
+ * sent them, and the hub descriptor and BOS likewise as "hub" and "bos".
+ * With -v the configurations, interfaces and endpoints are included and
+ * devices are opened for their strings, hub descriptor, BOS and status,
+ * unless -r is given.  With -t each device carries its "children"
+ * instead of the list being flat.
+ */
+
+#define USB_DT_BOS	0x0f
+
+/* ---------------------------------------------------------------------- */
+
+static void json_name(struct json *j, const char *key, const char *name)
+{
+	if (name)
+		json_string(j, key, name);
+}
+
+static void json_bcd(struct json *j, const char *key, unsigned int bcd)
+{
+	char buf[16];
+
+	snprintf(buf, sizeof(buf), "%x.%02x", bcd >> 8, bcd & 0xff);
+	json_string(j, key, buf);
+}
+
+static void json_dev_string(struct json *j, const char *key,
+			    libusb_device_handle *udev, u_int8_t id)
+{
+	char buf[MY_STRING_MAX];
+
+	if (udev && id && get_dev_string(buf, sizeof(buf), udev, id) > 0)
+		json_string(j, key, buf);
+}
+
+/* class specific and other descriptors libusb does not parse */
+static void json_extra(struct json *j, const unsigned char *buf, int size)
+{
+	if (size <= 0)
+		return;
+	json_array_begin(j, "extra");
+	while (size >= 2 && buf[0] >= 2 && buf[0] <= size) {
+		json_object_begin(j, NULL);
+		json_uint(j, "bDescriptorType", buf[1]);
+		if (buf[0] >= 3)
+			json_uint(j, "bDescriptorSubtype", buf[2]);
+		json_hex(j, "data", buf, buf[0]);
+		json_object_end(j);
+		size -= buf[0];
+		buf += buf[0];
+	}
+	/* whatever does not parse as descriptors */
+	if (size > 0) {
+		json_object_begin(j, NULL);
+		json_hex(j, "junk", buf, size);
+		json_object_end(j);
+	}
+	json_array_end(j);
+}
+
+static void json_endpoint(struct json *j, const struct libusb_endpoint_descriptor *ep)
+{
+	json_object_begin(j, NULL);
+	json_uint(j, "bEndpointAddress", ep->bEndpointAddress);
+	json_uint(j, "bmAttributes", ep->bmAttributes);
+	json_uint(j, "wMaxPacketSize", ep->wMaxPacketSize);
+	json_uint(j, "bInterval", ep->bInterval);
+	if (ep->bLength == LIBUSB_DT_ENDPOINT_AUDIO_SIZE) {
+		json_uint(j, "bRefresh", ep->bRefresh);
+		json_uint(j, "bSynchAddress", ep->bSynchAddress);
+	}
+	json_extra(j, ep->extra, ep->extra_length);
+	json_object_end(j);
+}
+
+static void json_altsetting(struct json *j, libusb_device_handle *udev,
+			    const struct libusb_interface_descriptor *alt)
+{
+	int i;
+
+	json_object_begin(j, NULL);
+	json_uint(j, "bInterfaceNumber", alt->bInterfaceNumber);
+	json_uint(j, "bAlternateSetting", alt->bAlternateSetting);
+	json_uint(j, "bNumEndpoints", alt->bNumEndpoints);
+	json_uint(j, "bInterfaceClass", alt->bInterfaceClass);
+	json_name(j, "class", names_class(alt->bInterfaceClass));
+	json_uint(j, "bInterfaceSubClass", alt->bInterfaceSubClass);
+	json_name(j, "subclass", names_subclass(alt->bInterfaceClass,
+						 alt->bInterfaceSubClass));
+	json_uint(j, "bInterfaceProtocol", alt->bInterfaceProtocol);
+	json_name(j, "protocol", names_protocol(alt->bInterfaceClass,
+						 alt->bInterfaceSubClass,
+						 alt->bInterfaceProtocol));
+	json_uint(j, "iInterface", alt->iInterface);
+	json_dev_string(j, "interface", udev, alt->iInterface);
+	json_extra(j, alt->extra, alt->extra_length);
+	json_array_begin(j, "endpoints");
+	for (i = 0; i < alt->bNumEndpoints; i++)
+		json_endpoint(j, &alt->endpoint[i]);
+	json_array_end(j);
+	json_object_end(j);
+}
+
+static void json_config(struct json *j, libusb_device_handle *udev,
+			const struct libusb_config_descriptor *config)
+{
+	int i, k;
+
+	json_object_begin(j, NULL);
+	json_uint(j, "wTotalLength", config->wTotalLength);
+	json_uint(j, "bNumInterfaces", config->bNumInterfaces);
+	json_uint(j, "bConfigurationValue", config->bConfigurationValue);
+	json_uint(j, "iConfiguration", config->iConfiguration);
+	json_dev_string(j, "configuration", udev, config->iConfiguration);
+	json_uint(j, "bmAttributes", config->bmAttributes);
+	json_uint(j, "MaxPower", config->MaxPower);
+	json_extra(j, config->extra, config->extra_length);
+	json_array_begin(j, "interfaces");
+	for (i = 0; i < config->bNumInterfaces; i++) {
+		const struct libusb_interface *intf = &config->interface[i];
+
+		json_array_begin(j, NULL);
+		for (k = 0; k < intf->num_altsetting; k++)
+			json_altsetting(j, udev, &intf->altsetting[k]);
+		json_array_end(j);
+	}
+	json_array_end(j);
+	json_object_end(j);
+}
+
+/* the same requests dumpdev() makes, so prefetch_dump() covers them */
+static void json_live(struct json *j, libusb_device_handle *udev,
+		      const struct libusb_device_descriptor *desc)
+{
+	unsigned char buf[BOS_DESC_BYTELEN > HUB_DESC_BYTELEN ?
+			  BOS_DESC_BYTELEN : HUB_DESC_BYTELEN];
+	int ret;
+
+	if (desc->bDeviceClass == LIBUSB_CLASS_HUB) {
+		ret = xfer_control(udev,
+			LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_DEVICE,
+			LIBUSB_REQUEST_GET_DESCRIPTOR,
+			(desc->bcdUSB == 0x0300 ? 0x2A : 0x29) << 8, 0,
+			buf, HUB_DESC_BYTELEN, CTRL_TIMEOUT);
+		if (ret > 0)
+			json_hex(j, "hub", buf, ret);
+	}
+	if (desc->bcdUSB >= 0x0201) {
+		ret = xfer_control(udev, LIBUSB_ENDPOINT_IN | LIBUSB_RECIPIENT_DEVICE,
+			LIBUSB_REQUEST_GET_DESCRIPTOR, USB_DT_BOS << 8, 0,
+			buf, 5, CTRL_TIMEOUT);
+		if (ret == 5) {
+			unsigned int len = buf[2] | (buf[3] << 8);
+
+			if (len > 5 && len <= BOS_DESC_BYTELEN)
+				ret = xfer_control(udev,
+					LIBUSB_ENDPOINT_IN | LIBUSB_RECIPIENT_DEVICE,
+					LIBUSB_REQUEST_GET_DESCRIPTOR, USB_DT_BOS << 8, 0,
+					buf, len, CTRL_TIMEOUT);
+			if (ret > 0)
+				json_hex(j, "bos", buf, ret);
+		}
+	}
+	ret = xfer_control(udev,
+		LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_STANDARD | LIBUSB_RECIPIENT_DEVICE,
+		LIBUSB_REQUEST_GET_STATUS, 0, 0, buf, 2, CTRL_TIMEOUT);
+	if (ret == 2)
+		json_uint(j, "status", buf[0] | (buf[1] << 8));
+}
+
+static void json_device(struct json *j, const struct usbdevice *d,
+			int verbose, int treemode)
+{
+	const struct libusb_device_descriptor *desc = &d->desc;
+	libusb_device_handle *udev = NULL;
+	char buf[MY_STRING_MAX];
+	const struct list_head *pos;
+	int i;
+
+	json_object_begin(j, NULL);
+	json_uint(j, "bus", d->busnum);
+	json_uint(j, "device", d->devnum);
+	get_port_path(d->dev, buf, sizeof(buf));
+	json_string(j, "path", buf);
+	if (d->parent) {
+		get_port_path(d->parent->dev, buf, sizeof(buf));
+		json_string(j, "parent", buf);
+		json_uint(j, "port", (d->location_id >> (24 - 4 * d->depth)) & 0xf);
+	} else
+		json_null(j, "parent");
+	json_uint(j, "depth", d->depth);
+	switch (d->speed) {
+	case LIBUSB_SPEED_LOW:		json_string(j, "speed", "1.5"); break;
+	case LIBUSB_SPEED_FULL:		json_string(j, "speed", "12"); break;
+	case LIBUSB_SPEED_HIGH:		json_string(j, "speed", "480"); break;
+	case LIBUSB_SPEED_SUPER:	json_string(j, "speed", "5000"); break;
+	default:			json_null(j, "speed"); break;
+	}
+
+	json_bcd(j, "bcdUSB", desc->bcdUSB);
+	json_uint(j, "bDeviceClass", desc->bDeviceClass);
+	json_name(j, "class", names_class(desc->bDeviceClass));
+	json_uint(j, "bDeviceSubClass", desc->bDeviceSubClass);
+	json_name(j, "subclass", names_subclass(desc->bDeviceClass,
+						 desc->bDeviceSubClass));
+	json_uint(j, "bDeviceProtocol", desc->bDeviceProtocol);
+	json_name(j, "protocol", names_protocol(desc->bDeviceClass,
+						 desc->bDeviceSubClass,
+						 desc->bDeviceProtocol));
+	json_uint(j, "bMaxPacketSize0", desc->bMaxPacketSize0);
+	json_uint(j, "idVendor", desc->idVendor);
+	if (get_vendor_string(buf, sizeof(buf), d->dev) > 0)
+		json_string(j, "vendor", buf);
+	json_uint(j, "idProduct", desc->idProduct);
+	if (get_product_string(buf, sizeof(buf), d->dev) > 0)
+		json_string(j, "product", buf);
+	json_bcd(j, "bcdDevice", desc->bcdDevice);
+	json_uint(j, "iManufacturer", desc->iManufacturer);
+	json_uint(j, "iProduct", desc->iProduct);
+	json_uint(j, "iSerial", desc->iSerialNumber);
+	json_uint(j, "bNumConfigurations", desc->bNumConfigurations);
+
+	if (verbose) {
+		udev = open_device(d->dev);
+		prefetch_dump(d->dev, udev, desc);
+		json_object_begin(j, "strings");
+		json_dev_string(j, "manufacturer", udev, desc->iManufacturer);
+		json_dev_string(j, "product", udev, desc->iProduct);
+		json_dev_string(j, "serial", udev, desc->iSerialNumber);
+		json_object_end(j);
+		json_array_begin(j, "configurations");
+		for (i = 0; i < desc->bNumConfigurations; i++) {
+			struct libusb_config_descriptor *config;
+
+			if (get_config(d->dev, i, &config) == 0)
+				json_config(j, udev, config);
+		}
+		json_array_end(j);
+		if (udev)
+			json_live(j, udev, desc);
+		close_device(udev);
+	}
+
+	if (treemode) {
+		json_array_begin(j, "children");
+		for (pos = d->children.next; pos != &d->children; pos = pos->next)
+			json_device(j, list_entry(pos, struct usbdevice, list),
+				    verbose, treemode);
+		json_array_end(j);
+	}
+	json_object_end(j);
+}
+
+/* the JSON renderer; like the listing it fails if nothing was selected */
+int lsusb_json(const struct usbmodel *m, int verbose, int treemode)
+{
+	const struct list_head *pos;
+	struct json j;
+	unsigned int i;
+	int status = 1;
+
+	json_init(&j, stdout);
+	json_object_begin(&j, NULL);
+	json_array_begin(&j, "devices");
+	if (treemode) {
+		for (pos = m->roots.next; pos != &m->roots; pos = pos->next)
+			json_device(&j, list_entry(pos, struct usbdevice, list),
+				    verbose, treemode);
+		status = 0;
+	} else {
+		for (i = 0; i < m->ndevices; i++) {
+			if (!m->devices[i]->selected)
+				continue;
+			json_device(&j, m->devices[i], verbose, treemode);
+			status = 0;
+		}
+	}
+	json_array_end(&j);
+	json_object_end(&j);
+	return status;
+}
@@ -0,0 +1,305 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-model.c  --  the devices lsusb shows, gathered once
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libusb.h>
+
+#include "list.h"
+#include "lsusb.h"
+#include "snapshot.h"
+#include "timing.h"
+#include "usbmisc.h"
+
+/*
+ * One enumeration per run.  Every output (the listing, the verbose dump,
+ * the tree) walks the devices of this model.  The model stops at the
+ * device: configurations, interfaces, altsettings, endpoints and the
+ * class descriptors they carry come from get_config(), which parses each
+ * configuration once and shares it, and the -v dumpers still decode them
+ * as they print.
+ *
+ * The hierarchy is built from location IDs (0xbbdddddd):
+ *   bb  -- bus number
+ *   dddddd -- up to six levels for the tree, each digit represents its
+ *             position on that level
+ *
+ * Sorting the devices by bus (highest first) and then by location gives
+ * a depth first order of the whole tree, so one pass with a stack of
+ * ancestors links every device below its hub.
+ *
+ * lsusb --watch keeps the model for as long as it runs, adding and
+ * removing single devices as they come and go.  Every device holds its
+ * own reference, so the libusb device list is only needed while building.
+ */
+
+static unsigned int location_depth(unsigned int location_id)
+{
+	unsigned int depth = 0;
+
+	while (depth < 6 && (location_id >> (20 - 4 * depth)) & 0xf)
+		depth++;
+	return depth;
+}
+
+/* buses in descending order, like the tree output always had */
+static unsigned int sort_key(const struct usbdevice *d)
+{
+	return d->location_id ^ 0xff000000;
+}
+
+static int cmp_devices(const void *a, const void *b)
+{
+	unsigned int ka = sort_key(*(const struct usbdevice * const *)a);
+	unsigned int kb = sort_key(*(const struct usbdevice * const *)b);
+
+	return ka < kb ? -1 : ka > kb;
+}
+
+static int is_ancestor(const struct usbdevice *parent, const struct usbdevice *d)
+{
+	unsigned int mask = 0xff000000 | (0x00ffffff & ~(0x00ffffff >> (4 * parent->depth)));
+
+	return parent->depth < d->depth &&
+		(d->location_id & mask) == parent->location_id;
+}
+
+static int link_tree(struct usbmodel *m)
+{
+	struct usbdevice **sorted, **stack;
+	unsigned int i, top;
+
+	sorted = calloc(m->ndevices ? m->ndevices : 1, sizeof(*sorted));
+	stack = calloc(m->ndevices ? m->ndevices : 1, sizeof(*stack));
+	if (!sorted || !stack) {
+		free(sorted);
+		free(stack);
+		return -1;
+	}
+	for (i = 0; i < m->ndevices; i++)
+		sorted[i] = m->devices[i];
+	qsort(sorted, m->ndevices, sizeof(*sorted), cmp_devices);
+
+	/* stack holds the path from a root hub down to the previous device */
+	for (i = 0, top = 0; i < m->ndevices; i++) {
+		while (top && !is_ancestor(stack[top - 1], sorted[i]))
+			top--;
+		sorted[i]->parent = top ? stack[top - 1] : NULL;
+		list_add_tail(&sorted[i]->list,
+			      top ? &stack[top - 1]->children : &m->roots);
+		stack[top++] = sorted[i];
+	}
+	free(sorted);
+	free(stack);
+	return 0;
+}
+
+static struct usbdevice *device_new(libusb_device *dev)
+{
+	struct usbdevice *d = calloc(1, sizeof(*d));
+
+	if (!d)
+		return NULL;
+	/* the descriptor is cached by libusb, no I/O here */
+	if (usbdev_get_device_descriptor(dev, &d->desc) < 0) {
+		free(d);
+		return NULL;
+	}
+	d->dev = usbdev_ref_device(dev);
+	d->busnum = usbdev_get_bus_number(dev);
+	d->devnum = usbdev_get_device_address(dev);
+	d->location_id = get_location_id(dev);
+	d->depth = location_depth(d->location_id);
+	d->speed = usbdev_get_device_speed(dev);
+	d->selected = filter_match(dev, &d->desc);
+	INIT_LIST_HEAD(&d->children);
+	return d;
+}
+
+static void device_free(struct usbdevice *d)
+{
+	usbdev_unref_device(d->dev);
+	free(d->name);
+	free(d);
+}
+
+int usbmodel_build(struct usbmodel *m, libusb_context *ctx)
+{
+	libusb_device **list;
+	u_int64_t start = timing_start();
+	ssize_t num_devs, i;
+
+	m->devices = NULL;
+	m->ndevices = 0;
+	m->size = 0;
+	INIT_LIST_HEAD(&m->roots);
+
+	num_devs = usbdev_get_device_list(ctx, &list);
+	if (num_devs < 0)
+		return num_devs;
+	m->devices = calloc(num_devs ? num_devs : 1, sizeof(*m->devices));
+	if (!m->devices) {
+		fprintf(stderr, "out of memory\n");
+		usbdev_free_device_list(list, 1);
+		return LIBUSB_ERROR_NO_MEM;
+	}
+	m->size = num_devs;
+
+	for (i = 0; i < num_devs; i++) {
+		struct usbdevice *d = device_new(list[i]);
+
+		if (d)
+			m->devices[m->ndevices++] = d;
+	}
+	usbdev_free_device_list(list, 1);
+
+	if (link_tree(m) < 0) {
+		fprintf(stderr, "out of memory\n");
+		usbmodel_free(m);
+		return LIBUSB_ERROR_NO_MEM;
+	}
+	if (start)
+		timing_record(TIMING_ENUMERATE, NULL, 0, 0, start);
+	return 0;
+}
+
+void usbmodel_free(struct usbmodel *m)
+{
+	unsigned int i;
+
+	/* parsed configurations hold references on the devices */
+	config_cache_release_all();
+	for (i = 0; i < m->ndevices; i++)
+		device_free(m->devices[i]);
+	free(m->devices);
+	m->devices = NULL;
+	m->ndevices = 0;
+	m->size = 0;
+	INIT_LIST_HEAD(&m->roots);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/* d goes into head, which stays sorted */
+static void insert_sorted(struct list_head *head, struct usbdevice *d)
+{
+	struct list_head *pos;
+
+	for (pos = head->next; pos != head; pos = pos->next)
+		if (sort_key(list_entry(pos, struct usbdevice, list)) > sort_key(d))
+			break;
+	list_add_tail(&d->list, pos);
+}
+
+/* moves what belongs below d from head, which d's parent also holds */
+static void adopt_children(struct usbdevice *d, struct list_head *head)
+{
+	struct list_head *pos, *next;
+
+	for (pos = head->next; pos != head; pos = next) {
+		struct usbdevice *c = list_entry(pos, struct usbdevice, list);
+
+		next = pos->next;
+		if (c == d || !is_ancestor(d, c))
+			continue;
+		list_del(&c->list);
+		c->parent = d;
+		insert_sorted(&d->children, c);
+	}
+}
+
+struct usbdevice *usbmodel_find(const struct usbmodel *m, libusb_device *dev)
+{
+	unsigned int i;
+
+	for (i = 0; i < m->ndevices; i++)
+		if (m->devices[i]->dev == dev)
+			return m->devices[i];
+	return NULL;
+}
+
+/* a device that arrived; linked below the deepest hub the model has for it */
+struct usbdevice *usbmodel_add(struct usbmodel *m, libusb_device *dev)
+{
+	struct usbdevice *d, *parent = NULL;
+	struct usbdevice **devices;
+	struct list_head *head;
+	unsigned int i;
+
+	if (m->ndevices == m->size) {
+		devices = realloc(m->devices, (m->size * 2 + 16) * sizeof(*devices));
+		if (!devices)
+			return NULL;
+		m->devices = devices;
+		m->size = m->size * 2 + 16;
+	}
+	d = device_new(dev);
+	if (!d)
+		return NULL;
+
+	for (i = 0; i < m->ndevices; i++)
+		if (is_ancestor(m->devices[i], d) &&
+		    (!parent || m->devices[i]->depth > parent->depth))
+			parent = m->devices[i];
+	d->parent = parent;
+	head = parent ? &parent->children : &m->roots;
+	/* a hub seen after the devices on it */
+	adopt_children(d, head);
+	insert_sorted(head, d);
+	m->devices[m->ndevices++] = d;
+	return d;
+}
+
+/* a device that left; whatever was still below it moves up to its hub */
+void usbmodel_remove(struct usbmodel *m, struct usbdevice *d)
+{
+	struct list_head *head = d->parent ? &d->parent->children : &m->roots;
+	unsigned int i;
+
+	list_del(&d->list);
+	while (!list_empty(&d->children)) {
+		struct usbdevice *c = list_entry(d->children.next, struct usbdevice, list);
+
+		list_del(&c->list);
+		c->parent = d->parent;
+		insert_sorted(head, c);
+	}
+
+	for (i = 0; i < m->ndevices; i++)
+		if (m->devices[i] == d)
+			break;
+	if (i < m->ndevices) {
+		m->ndevices--;
+		memmove(&m->devices[i], &m->devices[i + 1],
+			(m->ndevices - i) * sizeof(*m->devices));
+	}
+
+	/* another device may turn up with the same address or location */
+	config_cache_forget(d->dev);
+#ifdef OS_LINUX
+	sysfs_dev_forget(d->location_id);
+#endif
+	device_free(d);
+}
@@ -0,0 +1,194 @@
+/*****************************************************************************/
+
+/*
+ *      lsusb-watch.c  --  follow devices as they come and go
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <libusb.h>
+
+#include "lsusb.h"
+
+/*
+ * lsusb --watch lists the devices once and then prints a line for every
+ * selected device that arrives or leaves.  The model is built once and
+ * then kept up to date one device at a time; names are resolved when a
+ * device is first shown and kept, since a device that left can no
+ * longer be asked.
+ *
+ * Events come from libusb hotplug callbacks, which may not do I/O, so
+ * the callback only queues them; they are applied between rounds of
+ * event handling.  The callback is registered before enumerating, so a
+ * device arriving meanwhile is not missed, and events for devices the
+ * model already agrees with are dropped.  Any libusb, or a stand-in for
+ * it, that delivers hotplug events can drive this; lsusb-replay does for
+ * a made up sysfs tree that is changed while it runs.
+ */
+
+struct watch_event {
+	struct watch_event *next;
+	libusb_device *dev;		/* referenced while queued */
+	libusb_hotplug_event event;
+};
+
+/*
+ * A signal that lands after watch_stop was checked but before libusb
+ * waits does not interrupt the wait, so no wait is longer than this.
+ */
+#define WATCH_POLL_MS	250
+
+static struct watch_event *queue_head, **queue_tail = &queue_head;
+static volatile sig_atomic_t watch_stop;
+
+/* ---------------------------------------------------------------------- */
+
+static int LIBUSB_CALL watch_hotplug(libusb_context *ctx, libusb_device *dev,
+				     libusb_hotplug_event event, void *user_data)
+{
+	struct watch_event *e = malloc(sizeof(*e));
+
+	if (!e) {
+		fprintf(stderr, "out of memory, missed a hotplug event\n");
+		return 0;
+	}
+	e->next = NULL;
+	e->dev = libusb_ref_device(dev);
+	e->event = event;
+	*queue_tail = e;
+	queue_tail = &e->next;
+	return 0;
+}
+
+static void watch_signal(int sig)
+{
+	watch_stop = 1;
+}
+
+static void show_device(struct usbdevice *d, const char *what)
+{
+	char vendor[LISTING_NAME_LEN], product[LISTING_NAME_LEN];
+
+	if (!d->selected)
+		return;
+	if (!d->name) {
+		get_listing_names(d->dev, &d->desc, vendor, product);
+		d->name = malloc(strlen(vendor) + strlen(product) + 2);
+		if (d->name)
+			sprintf(d->name, "%s %s", vendor, product);
+	}
+	printf("%sBus %03u Device %03u: ID %04x:%04x %s\n", what,
+	       d->busnum, d->devnum, d->desc.idVendor, d->desc.idProduct,
+	       d->name ? d->name : "");
+}
+
+static void apply_event(struct usbmodel *m, const struct watch_event *e)
+{
+	struct usbdevice *d = usbmodel_find(m, e->dev);
+
+	if (e->event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) {
+		if (d)
+			return;
+		d = usbmodel_add(m, e->dev);
+		if (!d) {
+			fprintf(stderr, "out of memory, missed a device\n");
+			return;
+		}
+		show_device(d, "added ");
+	} else if (d) {
+		show_device(d, "removed ");
+		usbmodel_remove(m, d);
+	}
+}
+
+static void drain_queue(struct usbmodel *m)
+{
+	struct watch_event *e;
+
+	while ((e = queue_head)) {
+		queue_head = e->next;
+		if (m)
+			apply_event(m, e);
+		libusb_unref_device(e->dev);
+		free(e);
+	}
+	queue_tail = &queue_head;
+}
+
+/* ---------------------------------------------------------------------- */
+
+int lsusb_watch(libusb_context *ctx)
+{
+	libusb_hotplug_callback_handle handle;
+	struct sigaction sa;
+	struct usbmodel model;
+	unsigned int i;
+	int err;
+
+	if (!libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG)) {
+		fprintf(stderr, "hotplug events are not supported on this system\n");
+		return 1;
+	}
+	err = libusb_hotplug_register_callback(ctx,
+			LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT,
+			LIBUSB_HOTPLUG_NO_FLAGS, LIBUSB_HOTPLUG_MATCH_ANY,
+			LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+			watch_hotplug, NULL, &handle);
+	if (err) {
+		fprintf(stderr, "unable to watch for hotplug events: %i\n", err);
+		return 1;
+	}
+	if (usbmodel_build(&model, ctx) < 0) {
+		libusb_hotplug_deregister_callback(ctx, handle);
+		drain_queue(NULL);
+		return 1;
+	}
+
+	for (i = 0; i < model.ndevices; i++)
+		show_device(model.devices[i], "");
+	fflush(stdout);
+
+	/* no SA_RESTART, so a signal ends the wait for events */
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = watch_signal;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+
+	while (!watch_stop) {
+		struct timeval tv = { 0, WATCH_POLL_MS * 1000 };
+
+		err = libusb_handle_events_timeout_completed(ctx, &tv, NULL);
+		if (err && err != LIBUSB_ERROR_INTERRUPTED) {
+			fprintf(stderr, "error waiting for hotplug events: %i\n", err);
+			break;
+		}
+		drain_queue(&model);
+		fflush(stdout);
+	}
+
+	libusb_hotplug_deregister_callback(ctx, handle);
+	drain_queue(NULL);
+	usbmodel_free(&model);
+	return err && err != LIBUSB_ERROR_INTERRUPTED;
+}
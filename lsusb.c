@@ -33,6 +33,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
 
 #ifdef HAVE_BYTESWAP_H
 #include <byteswap.h>
@@ -43,7 +47,10 @@
 
 #include "lsusb.h"
 #include "names.h"
+#include "snapshot.h"
+#include "timing.h"
 #include "usbmisc.h"
+#include "usbxfer.h"
 
 #include <getopt.h>
 
@@ -105,15 +112,16 @@
 #define VERBLEVEL_DEFAULT 0	/* 0 gives lspci behaviour; 1, lsusb-0.9 */
 
 #define CTRL_RETRIES	 2
-#define CTRL_TIMEOUT	(5*1000)	/* milliseconds */
 
-#define	HUB_STATUS_BYTELEN	3	/* max 3 bytes status = hub + 23 ports */
+#define	XFER_WINDOW	32	/* devices with requests in flight ahead of the dump */
 
 #ifdef OS_LINUX
 static const char procbususb[] = "/proc/bus/usb";
 #endif
 static unsigned int verblevel = VERBLEVEL_DEFAULT;
 static int readonly = 0;
+static int wake = 0;
+static unsigned int jobs = 1;
 static int do_report_desc = 1;
 static const char * const encryption_type[] = {
 	"UNSECURE",
@@ -156,7 +164,7 @@ static inline int typesafe_control_msg(libusb_device_handle *dev,
 	int value, int idx,
 	unsigned char *bytes, unsigned size, int timeout)
 {
-	int ret = libusb_control_transfer(dev, requesttype, request, value,
+	int ret = xfer_control(dev, requesttype, request, value,
 					idx, bytes, size, timeout);
 
 	return ret;
@@ -223,6 +231,68 @@ static const char *get_guid(const unsigned char *buf)
 
 /* ---------------------------------------------------------------------- */
 
+/*
+ * Opening a device that runtime PM has suspended resumes it, and a
+ * verbose dump then keeps it awake until it is idle long enough to be
+ * suspended again.  Unless --wake is given such a device is not opened:
+ * it is dumped from what the kernel cached, as with -r, and named at the
+ * end.  With -r no device is ever opened, so none is woken either.
+ */
+
+static unsigned int *asleep;
+static unsigned int nasleep, asleep_size;
+
+static int location_asleep(unsigned int location_id)
+{
+#ifdef OS_LINUX
+	if (wake || snapshot_loaded())
+		return 0;
+	return sysfs_dev_suspended(sysfs_dev_get(location_id));
+#else
+	return 0;
+#endif
+}
+
+static int device_asleep(libusb_device *dev)
+{
+	return location_asleep(get_location_id(dev));
+}
+
+static void note_asleep(unsigned int location_id)
+{
+	unsigned int *p, i;
+
+	for (i = 0; i < nasleep; i++)
+		if (asleep[i] == location_id)
+			return;
+	if (nasleep == asleep_size) {
+		p = realloc(asleep, (asleep_size * 2 + 16) * sizeof(*p));
+		if (!p)
+			return;
+		asleep = p;
+		asleep_size = asleep_size * 2 + 16;
+	}
+	asleep[nasleep++] = location_id;
+}
+
+static void report_asleep(void)
+{
+	char name[32];
+	unsigned int i;
+
+	if (nasleep) {
+		fprintf(stderr, "Left %u suspended device%s asleep, some information "
+			"is missing (--wake reads %s anyway):", nasleep,
+			nasleep > 1 ? "s" : "", nasleep > 1 ? "them" : "it");
+		for (i = 0; i < nasleep; i++)
+			fprintf(stderr, " %s", timing_location_name(asleep[i], name, sizeof(name)));
+		fprintf(stderr, "\n");
+	}
+	free(asleep);
+}
+
+/* ---------------------------------------------------------------------- */
+
 static void dump_bytes(const unsigned char *buf, unsigned int len)
 {
 	unsigned int i;
@@ -260,7 +330,7 @@ static void dump_device(libusb_device *dev, libusb_device_handle *udev)
 	char bcdUSB_flag[15];
 #endif
 
-	libusb_get_device_descriptor(dev, &descriptor);
+	usbdev_get_device_descriptor(dev, &descriptor);
 	if (get_vendor_string(vendor, sizeof(vendor), dev) == 0)
 		strcpy(vendor, "Unknown Vendor");
 	get_product_string(product, sizeof(product), dev);
@@ -269,7 +339,8 @@ static void dump_device(libusb_device *dev, libusb_device_handle *udev)
 			descriptor.bDeviceClass, descriptor.bDeviceSubClass);
 	get_protocol_string(proto, sizeof(proto), descriptor.bDeviceClass,
 			descriptor.bDeviceSubClass, descriptor.bDeviceProtocol);
-	if (!udev) {
+	/* only when open_device() tried; see dump_live_only() otherwise */
+	if (!udev && !readonly && !device_asleep(dev)) {
 		fprintf(stderr, "Couldn't open device, some information "
 			"will be missing\n");
 	}
@@ -294,7 +365,7 @@ static void dump_device(libusb_device *dev, libusb_device_handle *udev)
 	bcdUSB_flag[0] = '\0';
 	if (descriptor.bcdUSB == 0x0000) {
 		strcpy(bcdUSB_flag, " (estimated)");
-		int devSpeed = libusb_get_device_speed(dev);
+		int devSpeed = usbdev_get_device_speed(dev);
 		switch (devSpeed) {
 		case LIBUSB_SPEED_LOW:          descriptor.bcdUSB = 0x0110; break;
 		case LIBUSB_SPEED_FULL:         descriptor.bcdUSB = 0x0200; break;
@@ -529,7 +600,7 @@ static void dump_altsetting(libusb_device_handle *dev, const struct libusb_inter
 	if (dev) {
 		unsigned char driver[128];
 		driver[0] = '\0';
-		libusb_get_kernel_driver_name(libusb_get_device(dev), interface->bInterfaceNumber, driver, sizeof(driver));
+		usbdev_get_kernel_driver_name(usbdev_get_device(dev), interface->bInterfaceNumber, driver, sizeof(driver));
 		printf(        "    Interface Driver:           %s\n", driver); 
 	}
 
@@ -2975,7 +3046,7 @@ static void dump_hid_device(libusb_device_handle *dev,
 			printf("report descriptor too long\n");
 			continue;
 		}
-		if (libusb_claim_interface(dev, interface->bInterfaceNumber) == 0) {
+		if (usbdev_claim_interface(dev, interface->bInterfaceNumber) == 0) {
 			int retries = 4;
 			n = 0;
 			while (n < len && retries--)
@@ -2993,7 +3064,7 @@ static void dump_hid_device(libusb_device_handle *dev,
 					printf("          Warning: incomplete report descriptor\n");
 				dump_report_desc(dbuf, n);
 			}
-			libusb_release_interface(dev, interface->bInterfaceNumber);
+			usbdev_release_interface(dev, interface->bInterfaceNumber);
 		} else {
 			/* recent Linuxes require claim() for RECIP_INTERFACE,
 			 * so "rmmod hid" will often make these available.
@@ -3302,8 +3373,7 @@ bad:
 
 static void do_hub(libusb_device_handle *fd, unsigned tt_type, unsigned bcdUSB)
 {
-	unsigned char buf[7 /* base descriptor */
-			+ 2 /* bitmasks */ * HUB_STATUS_BYTELEN];
+	unsigned char buf[HUB_DESC_BYTELEN];
 	int i, ret, value;
 	unsigned int link_state;
 	char *link_state_descriptions[] = {
@@ -3831,7 +3901,7 @@ static void dump_bos_descriptor(libusb_device_handle *fd)
 	 * 6 bytes for Wireless USB, 7 bytes for USB 2.0 extension,
 	 * 10 bytes for SuperSpeed, 20 bytes for Container ID.
 	 */
-	unsigned char bos_desc[43];
+	unsigned char bos_desc[BOS_DESC_BYTELEN];
 	unsigned int bos_desc_size;
 	int size, ret;
 	unsigned char *buf;
@@ -3909,6 +3979,15 @@ static void dump_bos_descriptor(libusb_device_handle *fd)
 	}
 }
 
+/* in read-only mode descriptors come from what the kernel cached at enumeration */
+/* marks what read-only mode leaves out rather than dropping it silently */
+static void dump_live_only(const char *what, const char *why)
+{
+	printf("%s:\n"
+	       "  ** NOT READ: needs a live transfer, skipped %s **\n",
+	       what, why);
+}
+
 static void dumpdev(libusb_device *dev, libusb_device_handle *udev)
 {
 	struct libusb_device_descriptor desc;
@@ -3917,34 +3996,45 @@ static void dumpdev(libusb_device *dev, libusb_device_handle *udev)
 	otg = wireless = 0;
 
 	dump_device(dev, udev);
-	libusb_get_device_descriptor(dev, &desc);
+	usbdev_get_device_descriptor(dev, &desc);
 
 	if (desc.bcdUSB == 0x0250)
 		wireless = do_wireless(udev);
 	if (desc.bNumConfigurations) {
 		struct libusb_config_descriptor *config;
 
-		ret = libusb_get_config_descriptor(dev, 0, &config);
+		ret = get_config(dev, 0, &config);
 		if (ret) {
 			fprintf(stderr, "Couldn't get configuration descriptor 0, "
 					"some information will be missing\n");
 		} else {
 			otg = do_otg(config) || otg;
-			libusb_free_config_descriptor(config);
 		}
 
 		for (i = 0; i < desc.bNumConfigurations; ++i) {
-			ret = libusb_get_config_descriptor(dev, i, &config);
+			ret = get_config(dev, i, &config);
 			if (ret) {
 				fprintf(stderr, "Couldn't get configuration "
 						"descriptor %d, some information will "
 						"be missing\n", i);
 			} else {
 				dump_config(udev, config);
-				libusb_free_config_descriptor(config);
 			}
 		}
 	}
+	if (!udev && (readonly || device_asleep(dev))) {
+		const char *why = readonly ? "in read-only mode" : "as the device is suspended";
+
+		/* the debug descriptor is rare enough to leave out quietly */
+		if (desc.bDeviceClass == LIBUSB_CLASS_HUB)
+			dump_live_only("Hub Descriptor", why);
+		if (desc.bcdUSB >= 0x0201)
+			dump_live_only("Binary Object Store Descriptor", why);
+		if (desc.bcdUSB == 0x0200)
+			dump_live_only("Device Qualifier (for other device speed)", why);
+		dump_live_only("Device Status", why);
+		return;
+	}
 	if (!udev)
 		return;
 
@@ -3959,7 +4049,7 @@ static void dumpdev(libusb_device *dev, libusb_device_handle *udev)
 	do_debug(udev);
 #ifdef OS_DARWIN
 	if (desc.bcdUSB == 0x0000 ) {
-		if (libusb_get_device_speed(libusb_get_device(udev)) == LIBUSB_SPEED_SUPER)
+		if (usbdev_get_device_speed(usbdev_get_device(udev)) == LIBUSB_SPEED_SUPER)
 		desc.bcdUSB = 0x0300;
 	}
 #endif
@@ -3968,27 +4058,270 @@ static void dumpdev(libusb_device *dev, libusb_device_handle *udev)
 
 /* ---------------------------------------------------------------------- */
 
+/* read-only mode never opens a device: that alone would resume it; see device_asleep() */
+libusb_device_handle *open_device(libusb_device *dev)
+{
+	libusb_device_handle *udev = NULL;
+	struct libusb_options *options;
+	struct libusb_os_options *os_options;
+	u_int64_t start;
+	int ret;
+
+	if (readonly)
+		return NULL;
+	if (device_asleep(dev)) {
+		note_asleep(get_location_id(dev));
+		return NULL;
+	}
+	if (snapshot_loaded())
+		return usbdev_open(dev, &udev) ? NULL : udev;
+
+	libusb_get_options(NULL,&options, &os_options);
+
+#if defined(OS_DARWIN)
+	os_options->optionB = 100;
+#elif defined(OS_LINUX)
+	os_options->optionA = 100;
+#endif
+	os_options->optionC = 50;
+	/* for lsusb and lsusb -v */
+	start = timing_start();
+	ret = usbdev_open_extended(dev, &udev, options, os_options);
+	if (start)
+		timing_record(TIMING_OPEN, NULL, 0, get_location_id(dev), start);
+	if (ret)
+		udev = NULL;
+	if (udev)
+	{
+#if defined(OS_DARWIN)
+		os_options->optionB = 75;
+#elif defined(OS_LINUX)
+		os_options->optionA = 75;
+#endif
+		os_options->optionC = 25;
+		libusb_set_options(udev,NULL,os_options);
+		libusb_get_options(udev,NULL, &os_options);
+	}
+	libusb_free_options(options, os_options);
+	return udev;
+}
+
+
+void close_device(libusb_device_handle *udev)
+{
+	if (!udev)
+		return;
+	xfer_release(udev);
+	free_dev_strings(udev);
+	usbdev_close(udev);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * Everything dumpdev() is going to ask a device for, queued up front so
+ * the requests run concurrently, for many devices at once.  Requests
+ * that depend on an answer (hub port status, the full BOS, strings) are
+ * queued from the completion of the one they depend on.
+ */
+
+static void prefetch_port_status(libusb_device_handle *udev, int status,
+				 const unsigned char *data, void *user_data)
+{
+	int i;
+
+	if (status < 9)
+		return;
+	for (i = 0; i < data[2]; i++)
+		xfer_prefetch(udev,
+			LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_OTHER,
+			LIBUSB_REQUEST_GET_STATUS, 0, i + 1, 4, CTRL_TIMEOUT,
+			NULL, NULL);
+}
+
+static void prefetch_bos(libusb_device_handle *udev, int status,
+			 const unsigned char *data, void *user_data)
+{
+	unsigned int len;
+
+	if (status < 5 || data[0] != 5 || data[1] != USB_DT_BOS)
+		return;
+	len = data[2] + (data[3] << 8);
+	if (len > 5 && len <= BOS_DESC_BYTELEN)
+		xfer_prefetch(udev, LIBUSB_ENDPOINT_IN | LIBUSB_RECIPIENT_DEVICE,
+			LIBUSB_REQUEST_GET_DESCRIPTOR, USB_DT_BOS << 8, 0, len,
+			CTRL_TIMEOUT, NULL, NULL);
+}
+
+/* string indexes in the descriptors that name functions and terminals */
+static unsigned int collect_string_ids(const unsigned char *buf, int size,
+				       const struct libusb_interface_descriptor *interface,
+				       u_int8_t *ids, unsigned int n, unsigned int max)
+{
+	for (; size >= 2 && buf[0] >= 2 && buf[0] <= size && n + 2 <= max;
+	     size -= buf[0], buf += buf[0]) {
+		if (buf[1] == USB_DT_INTERFACE_ASSOCIATION) {
+			if (buf[0] >= 8)
+				ids[n++] = buf[7];
+			continue;
+		}
+		if (buf[1] != USB_DT_CS_INTERFACE || !interface ||
+		    interface->bInterfaceSubClass != 1)
+			continue;
+		if (interface->bInterfaceClass == LIBUSB_CLASS_AUDIO &&
+		    interface->bInterfaceProtocol == USB_AUDIO_CLASS_1) {
+			if (buf[2] == 0x02 && buf[0] >= 12) {	/* INPUT_TERMINAL */
+				ids[n++] = buf[10];
+				ids[n++] = buf[11];
+			} else if (buf[2] == 0x03 && buf[0] >= 9)	/* OUTPUT_TERMINAL */
+				ids[n++] = buf[8];
+		} else if (interface->bInterfaceClass == LIBUSB_CLASS_AUDIO &&
+			   interface->bInterfaceProtocol == USB_AUDIO_CLASS_2) {
+			if (buf[2] == 0x02 && buf[0] >= 17) {
+				ids[n++] = buf[13];
+				ids[n++] = buf[16];
+			} else if (buf[2] == 0x03 && buf[0] >= 12)
+				ids[n++] = buf[11];
+		} else if (interface->bInterfaceClass == USB_CLASS_VIDEO) {
+			if (buf[2] == 0x02 && buf[0] >= 8)
+				ids[n++] = buf[7];
+			else if (buf[2] == 0x03 && buf[0] >= 9)
+				ids[n++] = buf[8];
+		}
+	}
+	return n;
+}
+
+void prefetch_dump(libusb_device *dev, libusb_device_handle *udev,
+		   const struct libusb_device_descriptor *desc)
+{
+	u_int8_t ids[512];
+	unsigned int n = 0;
+	int i, j, k;
+
+	if (!udev)
+		return;
+
+	if (desc->bDeviceClass == LIBUSB_CLASS_HUB)
+		xfer_prefetch(udev,
+			LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_CLASS | LIBUSB_RECIPIENT_DEVICE,
+			LIBUSB_REQUEST_GET_DESCRIPTOR,
+			(desc->bcdUSB == 0x0300 ? 0x2A : 0x29) << 8, 0,
+			HUB_DESC_BYTELEN, CTRL_TIMEOUT, prefetch_port_status, NULL);
+	if (desc->bcdUSB >= 0x0201)
+		xfer_prefetch(udev, LIBUSB_ENDPOINT_IN | LIBUSB_RECIPIENT_DEVICE,
+			LIBUSB_REQUEST_GET_DESCRIPTOR, USB_DT_BOS << 8, 0, 5,
+			CTRL_TIMEOUT, prefetch_bos, NULL);
+	if (desc->bcdUSB == 0x0200)
+		xfer_prefetch(udev,
+			LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_STANDARD | LIBUSB_RECIPIENT_DEVICE,
+			LIBUSB_REQUEST_GET_DESCRIPTOR, USB_DT_DEVICE_QUALIFIER << 8, 0,
+			10, CTRL_TIMEOUT, NULL, NULL);
+	xfer_prefetch(udev,
+		LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_STANDARD | LIBUSB_RECIPIENT_DEVICE,
+		LIBUSB_REQUEST_GET_DESCRIPTOR, USB_DT_DEBUG << 8, 0,
+		4, CTRL_TIMEOUT, NULL, NULL);
+	xfer_prefetch(udev,
+		LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_STANDARD | LIBUSB_RECIPIENT_DEVICE,
+		LIBUSB_REQUEST_GET_STATUS, 0, 0, 2, CTRL_TIMEOUT, NULL, NULL);
+
+	/* every string the dump shows, fetched in one batch */
+	ids[n++] = desc->iManufacturer;
+	ids[n++] = desc->iProduct;
+	ids[n++] = desc->iSerialNumber;
+	for (i = 0; i < desc->bNumConfigurations; i++) {
+		struct libusb_config_descriptor *config;
+
+		if (get_config(dev, i, &config))
+			continue;
+		if (n < sizeof(ids))
+			ids[n++] = config->iConfiguration;
+		n = collect_string_ids(config->extra, config->extra_length,
+				       NULL, ids, n, sizeof(ids));
+		for (j = 0; j < config->bNumInterfaces; j++)
+			for (k = 0; k < config->interface[j].num_altsetting; k++) {
+				const struct libusb_interface_descriptor *alt =
+					&config->interface[j].altsetting[k];
+
+				if (n < sizeof(ids))
+					ids[n++] = alt->iInterface;
+				n = collect_string_ids(alt->extra, alt->extra_length,
+						       alt, ids, n, sizeof(ids));
+			}
+	}
+	prefetch_dev_strings(udev, ids, n);
+}
+
+/* ---------------------------------------------------------------------- */
+
 #ifdef OS_LINUX
-static int dump_one_device(libusb_context *ctx, const char *path)
+#ifdef HAVE_LIBUSB_WRAP_SYS_DEVICE
+/*
+ * lsusb -D on a usbfs node opens the node before libusb starts and has
+ * libusb wrap it, so libusb need not enumerate the other devices.  This
+ * is decided before libusb_init() as that is when libusb would look for
+ * them.  -r must not open the node, since that resumes the device.
+ */
+static int open_usb_node(const char *path)
 {
-	libusb_device *dev;
-	libusb_device_handle *udev;
+	struct usb_node node;
+	int fd;
+
+	if (readonly || linux_get_usb_node(path, &node) < 0 || !node.usbfs ||
+	    location_asleep(node.location_id))
+		return -1;
+	fd = open(path, O_RDWR | O_CLOEXEC);
+	if (fd < 0)
+		return -1;
+	if (libusb_set_option(NULL, LIBUSB_OPTION_NO_DEVICE_DISCOVERY) != LIBUSB_SUCCESS) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+#endif
+
+static int dump_one_device(libusb_context *ctx, const char *path, int fd)
+{
+	struct usb_node node;
+	libusb_device *dev = NULL;
+	libusb_device_handle *udev = NULL;
 	struct libusb_device_descriptor desc;
 	char vendor[128], product[128];
 	int ret;
 
-	linux_get_usb_device(dev, ctx, path);
-	if (!dev) {
+	if (linux_get_usb_node(path, &node) < 0) {
 		fprintf(stderr, "Cannot find %s\n", path);
 		return 1;
 	}
-	/* for lsusb -D */
-	ret = libusb_open(dev, &udev);
-
-	if (ret) {
-		fprintf(stderr, "Couldn't open device, some information "
-			"will be missing\n");
-		udev = NULL;
+#ifdef HAVE_LIBUSB_WRAP_SYS_DEVICE
+	if (fd >= 0) {
+		ret = libusb_wrap_sys_device(ctx, (intptr_t)fd, &udev);
+		if (ret) {
+			fprintf(stderr, "Couldn't open %s: %s\n", path, libusb_error_name(ret));
+			return 1;
+		}
+		dev = libusb_ref_device(libusb_get_device(udev));
+		usbdev_pin(dev, node.busnum, node.devnum, node.location_id);
+	}
+#endif
+	if (!dev) {
+		dev = linux_get_usb_device(ctx, &node);
+		if (!dev) {
+			fprintf(stderr, "Cannot find %s\n", path);
+			return 1;
+		}
+		/* for lsusb -D; opening would resume the device */
+		if (!readonly && device_asleep(dev))
+			note_asleep(get_location_id(dev));
+		else if (!readonly) {
+			ret = libusb_open(dev, &udev);
+			if (ret) {
+				fprintf(stderr, "Couldn't open device, some information "
+					"will be missing\n");
+				udev = NULL;
+			}
+		}
 	}
 	libusb_get_device_descriptor(dev, &desc);
 	if (get_vendor_string(vendor, sizeof(vendor), dev) == 0)
@@ -3998,130 +4331,480 @@ static int dump_one_device(libusb_context *ctx, const char *path)
 					       desc.idProduct,
 					       vendor,
 					       product);
+	prefetch_dump(dev, udev, &desc);
 	dumpdev(dev, udev);
-	if (udev)
-		libusb_close(udev);
+	close_device(udev);
+	libusb_unref_device(dev);
 	return 0;
 }
 #endif
 
-static int list_devices(libusb_context *ctx, int busnum, int devnum, int vendorid, int productid)
+/* ---------------------------------------------------------------------- */
+
+/* the "vendor product" of a listing line, both buffers LISTING_NAME_LEN */
+void get_listing_names(libusb_device *dev, const struct libusb_device_descriptor *desc,
+		       char *vendor, char *product)
+{
+	char cls[LISTING_NAME_LEN], subcls[LISTING_NAME_LEN];
+
+	if (get_vendor_string(vendor, LISTING_NAME_LEN, dev) == 0)
+		strcpy(vendor, "Unknown Vendor");
+
+	if (get_product_string(product, LISTING_NAME_LEN, dev) == 0) {
+		if (desc->bDeviceClass > 0 && desc->bDeviceClass < 0xff) {
+			/* print subclass (unless "Unused") and class */
+			get_class_string(cls, sizeof(cls), desc->bDeviceClass);
+			get_subclass_string(subcls, sizeof(subcls),
+				       desc->bDeviceClass, desc->bDeviceSubClass);
+			if (strcmp(subcls,"Unused") != 0) {
+				strcpy(product,subcls);
+				strcat(product," ");
+			}
+			strcat(product, cls);
+		}
+	}
+}
+
+static void list_device(libusb_device *dev, const struct libusb_device_descriptor *desc,
+			libusb_device_handle *udev)
 {
-	libusb_device **list;
+	char vendor[LISTING_NAME_LEN], product[LISTING_NAME_LEN];
+	u_int64_t start = timing_start();
+
+	get_listing_names(dev, desc, vendor, product);
+	if (verblevel > 0)
+		printf("\n");
+	printf("Bus %03u Device %03u: ID %04x:%04x %s %s\n",
+			usbdev_get_bus_number(dev),
+			usbdev_get_device_address(dev),
+			desc->idVendor,
+			desc->idProduct,
+			vendor, product);
+	if (verblevel > 0)
+		dumpdev(dev, udev);
+	if (start)
+		timing_record(TIMING_RENDER, NULL, 0, get_location_id(dev), start);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * lsusb -j: up to N workers each dump one device at a time, so a device
+ * that times out on every request only holds up its own output.  libusb
+ * is not safe to fork once initialized, so the workers are forked before
+ * libusb_init() and each enumerates the bus with a context of its own the
+ * first time it is handed a device.  A device is handed over by its bus
+ * and address, with a pipe of its own for the output, and the output is
+ * printed in the original device order, giving the same bytes as a
+ * serial run.  Whatever a worker cannot dump is redone in-process.
+ */
+
+enum job_state {
+	JOB_WAITING, JOB_RUNNING, JOB_DONE, JOB_FAILED,
+	JOB_ASLEEP		/* not opened, so not worth a worker */
+};
+
+struct job {
+	libusb_device *dev;
 	struct libusb_device_descriptor desc;
-	char vendor[128], product[128], cls[128], subcls[128];
-	int status;
-	ssize_t num_devs, i;
-	int ret;
+	libusb_device_handle *udev;	/* serial runs only */
+	enum job_state state;
+	unsigned int worker;	/* the one dumping it */
+	int fd;			/* read end of the job's output */
+	char *out;
+	size_t len, alloc;
+};
 
-	status = 1; /* 1 device not found, 0 device found */
+struct worker {
+	pid_t pid;		/* -1 once gone */
+	int sock;		/* jobs go out, a status byte comes back */
+	int busy;
+};
 
-	num_devs = libusb_get_device_list(ctx, &list);
-	if (num_devs < 0)
-		goto error;
+static struct worker *worker;
+static unsigned int nworkers;
 
-	for (i = 0; i < num_devs; ++i) {
-		libusb_device *dev = list[i];
-		libusb_device_handle *udev = NULL;
-		uint8_t bnum = libusb_get_bus_number(dev);
-		uint8_t dnum = libusb_get_device_address(dev);
+/* a job is the device's bus and address, with the write end of its pipe attached */
+static int send_job(int sock, unsigned int id, int fd)
+{
+	char cbuf[CMSG_SPACE(sizeof(int))];
+	struct iovec iov = { &id, sizeof(id) };
+	struct msghdr msg;
+	struct cmsghdr *cmsg;
+
+	memset(&msg, 0, sizeof(msg));
+	memset(cbuf, 0, sizeof(cbuf));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+	memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+	return sendmsg(sock, &msg, 0) == sizeof(id) ? 0 : -1;
+}
 
-		if ((busnum != -1 && busnum != bnum) ||
-		    (devnum != -1 && devnum != dnum))
-			continue;
-		if (0 != libusb_get_device_descriptor(dev, &desc))
-			continue;
-		if ((vendorid != -1 && vendorid != desc.idVendor) ||
-		    (productid != -1 && productid != desc.idProduct))
-			continue;
-		status = 0;
-		if (get_vendor_string(vendor, sizeof(vendor), dev) == 0)
-			strcpy(vendor, "Unknown Vendor");
+static int recv_job(int sock, unsigned int *id, int *fd)
+{
+	char cbuf[CMSG_SPACE(sizeof(int))];
+	struct iovec iov = { id, sizeof(*id) };
+	struct msghdr msg;
+	struct cmsghdr *cmsg;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+	if (recvmsg(sock, &msg, 0) != sizeof(*id))
+		return -1;
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+		return -1;
+	memcpy(fd, CMSG_DATA(cmsg), sizeof(int));
+	return 0;
+}
 
-		/* for lsusb (no options) */
-		struct libusb_options *options;
-		struct libusb_os_options *os_options;
+static unsigned int job_id(libusb_device *dev)
+{
+	return (usbdev_get_bus_number(dev) << 8) | usbdev_get_device_address(dev);
+}
 
-		libusb_get_options(NULL,&options, &os_options);
+/* the worker's side: dump what comes in until the parent hangs up */
+static void run_worker(int sock)
+{
+	libusb_context *ctx = NULL;
+	libusb_device **list = NULL;
+	libusb_device_handle *udev;
+	libusb_device *dev;
+	struct libusb_device_descriptor desc;
+	ssize_t i, ndevs = -1;
+	unsigned int id;
+	char status;
+	int fd;
+
+	close(STDOUT_FILENO);
+	while (recv_job(sock, &id, &fd) == 0) {
+		if (fd != STDOUT_FILENO) {
+			dup2(fd, STDOUT_FILENO);
+			close(fd);
+		}
+		if (ndevs < 0 && libusb_init(&ctx) == 0) {
+			xfer_init(ctx);
+			ndevs = libusb_get_device_list(ctx, &list);
+		}
+		for (i = 0, dev = NULL; i < ndevs && !dev; i++)
+			if (job_id(list[i]) == id)
+				dev = list[i];
+		/* a device this worker does not see is left to the parent */
+		status = 1;
+		if (dev && !libusb_get_device_descriptor(dev, &desc)) {
+			udev = open_device(dev);
+			list_device(dev, &desc, udev);
+			close_device(udev);
+			status = fflush(stdout) ? 1 : 0;
+			clearerr(stdout);
+		}
+		/* the parent sees the end of the output, then the status */
+		close(STDOUT_FILENO);
+		if (write(sock, &status, 1) != 1)
+			break;
+	}
+	/* _exit(): the atexit handlers belong to the parent */
+	_exit(0);
+}
 
-		options->open_from_cache = readonly;
+static void stop_worker(struct worker *w)
+{
+	close(w->sock);
+	while (waitpid(w->pid, NULL, 0) < 0 && errno == EINTR)
+		;
+	w->pid = -1;
+}
 
-#if defined(OS_DARWIN)
-		os_options->optionB = 100;
-#elif defined(OS_LINUX)
-		os_options->optionA = 100;
-#endif
-		os_options->optionC = 50;
-		/* for lsusb and lsusb -v */
-		ret = libusb_open_extended(dev, &udev, options, os_options);
+/* forks the -j workers; must come before libusb_init() */
+static void start_workers(unsigned int n)
+{
+	unsigned int i;
+	int sv[2];
 
-		if (ret) {
-			udev = NULL;
+	worker = calloc(n, sizeof(*worker));
+	if (!worker)
+		return;
+	/* what is buffered so far is ours to print, not the workers' */
+	fflush(stdout);
+	for (nworkers = 0; nworkers < n; nworkers++) {
+		struct worker *w = &worker[nworkers];
+
+		w->pid = -1;
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+			break;
+		w->pid = fork();
+		if (w->pid == 0) {
+			close(sv[0]);
+			for (i = 0; i < nworkers; i++)
+				close(worker[i].sock);
+			run_worker(sv[1]);
 		}
-		if (udev)
-		{
-#if defined(OS_DARWIN)
-			os_options->optionB = 75;
-#elif defined(OS_LINUX)
-			os_options->optionA = 75;
-#endif
-			os_options->optionC = 25;
-			libusb_set_options(udev,NULL,os_options);
-			if (readonly) {
-#if defined(OS_DARWIN)
-				/* uncomment the next line if you want to see the effect of setting options */
-				//fprintf(stderr,"Trying to change optionB to 75 and optionC to 25. ");
-#elif defined(OS_LINUX)
-				/* uncomment the next line if you want to see the effect of setting options */
-				//fprintf(stderr,"Trying to change optionA to 75 and optionC to 25. ");
-#endif
+		close(sv[1]);
+		if (w->pid < 0) {
+			close(sv[0]);
+			break;
+		}
+		w->sock = sv[0];
+	}
+}
+
+static void stop_workers(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < nworkers; i++)
+		if (worker[i].pid > 0)
+			stop_worker(&worker[i]);
+	free(worker);
+	worker = NULL;
+	nworkers = 0;
+}
+
+static int give_job(unsigned int w, struct job *job, unsigned int i)
+{
+	int fds[2];
+
+	if (pipe(fds) < 0)
+		return -1;
+	if (send_job(worker[w].sock, job_id(job[i].dev), fds[1]) < 0) {
+		close(fds[0]);
+		close(fds[1]);
+		return -1;
+	}
+	close(fds[1]);
+	worker[w].busy = 1;
+	job[i].worker = w;
+	job[i].fd = fds[0];
+	job[i].state = JOB_RUNNING;
+	return 0;
+}
+
+/* returns 1 once the worker has closed its end */
+static int read_job(struct job *job)
+{
+	ssize_t r;
+
+	if (job->len == job->alloc) {
+		size_t alloc = job->alloc ? 2 * job->alloc : 4096;
+		char *out = realloc(job->out, alloc);
+
+		if (!out)
+			return -1;
+		job->out = out;
+		job->alloc = alloc;
+	}
+	r = read(job->fd, job->out + job->len, job->alloc - job->len);
+	if (r < 0)
+		return (errno == EINTR || errno == EAGAIN) ? 0 : -1;
+	job->len += r;
+	return r == 0;
+}
+
+static void finish_job(struct job *job, int ok)
+{
+	struct worker *w = &worker[job->worker];
+	char status = 1;
+	ssize_t r;
+
+	close(job->fd);
+	job->fd = -1;
+	while ((r = read(w->sock, &status, 1)) < 0 && errno == EINTR)
+		;
+	/* no status: the worker died, and its job is redone in-process */
+	if (r != 1)
+		stop_worker(w);
+	w->busy = 0;
+	job->state = ok && r == 1 && !status ? JOB_DONE : JOB_FAILED;
+}
+
+static void run_jobs(struct job *job, unsigned int n)
+{
+	struct pollfd *pfd;
+	unsigned int *slot;
+	unsigned int next = 0, emit = 0, running;
+	unsigned int i, w, alive, npfd;
+	void (*sigpipe)(int);
+
+	pfd = calloc(nworkers, sizeof(*pfd));
+	slot = calloc(nworkers, sizeof(*slot));
+	if (!pfd || !slot)
+		stop_workers();
+	/* a worker that died is noticed from its socket, not by a signal */
+	sigpipe = signal(SIGPIPE, SIG_IGN);
+
+	while (emit < n) {
+		while (next < n) {
+			if (device_asleep(job[next].dev)) {
+				job[next].state = JOB_ASLEEP;
+				next++;
+				continue;
 			}
-			libusb_get_options(udev,NULL, &os_options);
-			if (readonly) {
-#if defined(OS_DARWIN)
-				/* uncomment the next line if you want to see the effect of setting options */
-				//fprintf(stderr,"Returned optionB at %d and optionC at %d\n", os_options->optionB, os_options->optionC);
-#elif defined(OS_LINUX)
-				/* uncomment the next line if you want to see the effect of setting options */
-				//fprintf(stderr,"Returned optionA at %d and optionC at %d\n", os_options->optionA, os_options->optionC);
-#endif
+			for (w = alive = 0; w < nworkers; w++) {
+				if (worker[w].pid < 0)
+					continue;
+				alive++;
+				if (!worker[w].busy)
+					break;
 			}
+			if (w == nworkers && alive)
+				break;
+			/* without a worker left, the rest is done in-process */
+			if (w == nworkers || give_job(w, job, next) < 0)
+				job[next].state = JOB_FAILED;
+			next++;
 		}
-		libusb_free_options(options, os_options);
-
-		if (get_product_string(product, sizeof(product), dev) == 0) {
-			if (desc.bDeviceClass > 0 && desc.bDeviceClass < 0xff) {
-				/* print subclass (unless "Unused") and class */
-				get_class_string(cls, sizeof(cls), desc.bDeviceClass);
-				get_subclass_string(subcls, sizeof(subcls),
-					       desc.bDeviceClass, desc.bDeviceSubClass);
-				if (strcmp(subcls,"Unused") != 0) {
-					strcpy(product,subcls);
-					strcat(product," ");
-				}
-				strcat(product, cls);
+
+		/* print everything that is complete, in order */
+		for (; emit < n && job[emit].state >= JOB_DONE; emit++) {
+			if (job[emit].state == JOB_DONE) {
+				fwrite(job[emit].out, 1, job[emit].len, stdout);
+			} else {
+				libusb_device_handle *udev = open_device(job[emit].dev);
+
+				fflush(stdout);
+				list_device(job[emit].dev, &job[emit].desc, udev);
+				close_device(udev);
 			}
+			free(job[emit].out);
+			job[emit].out = NULL;
 		}
-		if (verblevel > 0)
-			printf("\n");
-		printf("Bus %03u Device %03u: ID %04x:%04x %s %s\n",
-				bnum, dnum,
-				desc.idVendor,
-				desc.idProduct,
-				vendor, product);
-		if (verblevel > 0)
-			dumpdev(dev, udev);
-		if (udev) {
-			libusb_close(udev);
+
+		fflush(stdout);
+		for (i = emit, running = npfd = 0; i < next; i++) {
+			if (job[i].state != JOB_RUNNING)
+				continue;
+			pfd[npfd].fd = job[i].fd;
+			pfd[npfd].events = POLLIN;
+			slot[npfd++] = i;
+			running++;
 		}
-		libusb_unref_device(dev);
+		if (!running)
+			continue;
+		if (poll(pfd, npfd, -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			/* no way to wait on the workers: finish in-process */
+			for (i = 0; i < npfd; i++) {
+				close(job[slot[i]].fd);
+				job[slot[i]].fd = -1;
+				job[slot[i]].state = JOB_FAILED;
+			}
+			stop_workers();
+			continue;
+		}
+		for (i = 0; i < npfd; i++) {
+			int r;
+
+			if (!(pfd[i].revents & (POLLIN | POLLHUP | POLLERR)))
+				continue;
+			r = read_job(&job[slot[i]]);
+			if (r != 0)
+				finish_job(&job[slot[i]], r > 0);
+		}
+	}
+
+	stop_workers();
+	signal(SIGPIPE, sigpipe);
+	free(pfd);
+	free(slot);
+}
+
+/* opens and prefetches up to XFER_WINDOW devices ahead of the one being dumped */
+static void run_serial(struct job *job, unsigned int n)
+{
+	unsigned int i, next = 0;
+
+	/* the one line listing needs nothing a device handle would give */
+	if (verblevel <= 0) {
+		for (i = 0; i < n; i++)
+			list_device(job[i].dev, &job[i].desc, NULL);
+		return;
+	}
+
+	for (i = 0; i < n; i++) {
+		for (; next < n && next < i + XFER_WINDOW; next++) {
+			job[next].udev = open_device(job[next].dev);
+			prefetch_dump(job[next].dev, job[next].udev, &job[next].desc);
+		}
+		list_device(job[i].dev, &job[i].desc, job[i].udev);
+		close_device(job[i].udev);
+	}
+}
+
+/* the listing and verbose dump renderer */
+static int list_devices(const struct usbmodel *m)
+{
+	struct job *job;
+	unsigned int njobs = 0;
+	int status;
+	unsigned int i;
+
+	status = 1; /* 1 device not found, 0 device found */
+
+	job = calloc(m->ndevices ? m->ndevices : 1, sizeof(*job));
+	if (!job) {
+		fprintf(stderr, "out of memory\n");
+		return status;
 	}
 
-	libusb_free_device_list(list, 0);
-error:
+	for (i = 0; i < m->ndevices; ++i) {
+		const struct usbdevice *d = m->devices[i];
+
+		if (!d->selected)
+			continue;
+		status = 0;
+		job[njobs].dev = d->dev;
+		job[njobs].desc = d->desc;
+		job[njobs].fd = -1;
+		njobs++;
+	}
+
+	/* main() started the workers if -j applies to this run */
+	if (nworkers)
+		run_jobs(job, njobs);
+	else
+		run_serial(job, njobs);
+	free(job);
 	return status;
 }
 
+/* enumerate once and hand the result to the renderer asked for */
+static int render_devices(libusb_context *ctx, int treemode, int json,
+			  const char *savefile)
+{
+	struct usbmodel model;
+	u_int64_t start;
+	int status;
+
+	if (usbmodel_build(&model, ctx) < 0)
+		return 1;
+	/* the listing times each device, the others all of it */
+	start = timing_start();
+	if (json)
+		status = lsusb_json(&model, verblevel > 0, treemode);
+	else if (treemode)
+		status = lsusb_t(&model);
+	else {
+		start = 0;
+		status = list_devices(&model);
+	}
+	if (start)
+		timing_record(TIMING_RENDER, json ? "json" : "tree", 0, 0, start);
+	/* after rendering, so it holds everything the renderer asked for */
+	if (savefile && snapshot_save(savefile, &model) < 0)
+		status = 1;
+	usbmodel_free(&model);
+	return status;
+}
 
 /* ---------------------------------------------------------------------- */
 
@@ -4134,21 +4817,42 @@ int main(int argc, char *argv[])
 		{ "help", 0, 0, 'h' },
 		{ "tree", 0, 0, 't' },
 		{ "read-only", 0, 0, 'r' },
+		{ "wake", 0, 0, 'K' },
+		{ "jobs", 1, 0, 'j' },
+		{ "json", 0, 0, 'J' },
+		{ "save", 1, 0, 'W' },
+		{ "load", 1, 0, 'L' },
+		{ "diff", 1, 0, 'F' },
+		{ "watch", 0, 0, 'M' },
+		{ "timing", 2, 0, 'T' },
+		{ "stats", 0, 0, 'X' },
+		{ "class", 1, 0, 'C' },
+		{ "speed", 1, 0, 'S' },
+		{ "path", 1, 0, 'H' },
+		{ "serial", 1, 0, 'N' },
+#ifdef OS_LINUX
+		{ "driver", 1, 0, 'R' },
+		{ "devices", 0, 0, 'U' },
+#endif
 		{ 0, 0, 0, 0 }
 	};
 
 	libusb_context *ctx;
 	int c, err = 0;
 	unsigned int treemode = 0;
-	int bus = -1, devnum = -1, vendor = -1, product = -1;
+	int json = 0, watch = 0, timing = 0, devices = 0;
+	const char *tracefile = NULL;
 	const char *devdump = NULL;
+	int devfd = -1;
+	const char *savefile = NULL, *loadfile = NULL;
+	const char *diffold = NULL, *diffnew = NULL;
 	int help = 0;
 	char *cp;
 	int status;
 
 	setlocale(LC_CTYPE, "");
 
-	while ((c = getopt_long(argc, argv, "D:vtP:p:s:d:Vhr",
+	while ((c = getopt_long(argc, argv, "D:vtP:p:s:d:Vhrj:",
 			long_options, NULL)) != EOF) {
 		switch (c) {
 		case 'V':
@@ -4170,37 +4874,90 @@ int main(int argc, char *argv[])
 			readonly = 1;
 			break;
 
+		case 'K':
+			wake = 1;
+			break;
+
+		case 'J':
+			json = 1;
+			break;
+
+		case 'W':
+			savefile = optarg;
+			break;
+
+		case 'L':
+			loadfile = optarg;
+			break;
+
+		case 'F':
+			diffold = optarg;
+			break;
+
+		case 'M':
+			watch = 1;
+			break;
+
+		case 'T':
+			timing = 1;
+			tracefile = optarg;
+			break;
+
+		case 'X':
+			xfer_stats_enable();
+			break;
+
+		case 'j':
+			jobs = strtoul(optarg, &cp, 10);
+			if (*cp || !jobs)
+				err++;
+			break;
+
 		case 's':
-			cp = strchr(optarg, ':');
-			if (cp) {
-				*cp++ = 0;
-				if (*optarg)
-					bus = strtoul(optarg, NULL, 10);
-				if (*cp)
-					devnum = strtoul(cp, NULL, 10);
-			} else {
-				if (*optarg)
-					devnum = strtoul(optarg, NULL, 10);
-			}
+			if (filter_add(FILTER_BUSDEV, optarg) < 0)
+				err++;
 			break;
 
 		case 'd':
-			cp = strchr(optarg, ':');
-			if (!cp) {
+			if (filter_add(FILTER_VENDOR, optarg) < 0)
+				err++;
+			break;
+
+		case 'C':
+			if (filter_add(FILTER_CLASS, optarg) < 0)
 				err++;
-				break;
-			}
-			*cp++ = 0;
-			if (*optarg)
-				vendor = strtoul(optarg, NULL, 16);
-			if (*cp)
-				product = strtoul(cp, NULL, 16);
 			break;
 
+		case 'S':
+			if (filter_add(FILTER_SPEED, optarg) < 0)
+				err++;
+			break;
+
+		case 'H':
+			if (filter_add(FILTER_PATH, optarg) < 0)
+				err++;
+			break;
+
+		case 'N':
+			if (filter_add(FILTER_SERIAL, optarg) < 0)
+				err++;
+			break;
+
+#ifdef OS_LINUX
+		case 'R':
+			if (filter_add(FILTER_DRIVER, optarg) < 0)
+				err++;
+			break;
+#endif
+
 #ifdef OS_LINUX
 		case 'D':
 			devdump = optarg;
 			break;
+
+		case 'U':
+			devices = 1;
+			break;
 #endif
 
 		case '?':
@@ -4209,6 +4966,30 @@ int main(int argc, char *argv[])
 			break;
 		}
 	}
+	/* -D looks at this host's /dev, a snapshot has none */
+	if (devdump && (savefile || loadfile))
+		err++;
+	/* -D dumps that one device verbosely; it has no tree or JSON form */
+	if (devdump && (treemode || json))
+		err++;
+	/* --diff OLD NEW, or --diff OLD against the attached devices */
+	if (diffold) {
+		if (optind < argc)
+			diffnew = argv[optind++];
+		if (devdump || savefile || loadfile || treemode || json)
+			err++;
+	}
+	/* the one line listing, followed live */
+	if (watch && (devdump || savefile || loadfile || diffold ||
+		      treemode || json || verblevel > 0))
+		err++;
+	/* -r opens nothing, suspended or not */
+	if (readonly && wake)
+		err++;
+	/* the usb-devices report, read from sysfs alone */
+	if (devices && (devdump || savefile || loadfile || diffold || watch ||
+			treemode || json || verblevel > 0))
+		err++;
 	if (err || argc > optind || help) {
 		fprintf(stderr, "Usage: lsusb [options]...\n"
 			"List USB devices\n"
@@ -4220,12 +5001,57 @@ int main(int argc, char *argv[])
 			"  -d vendor:[product]\n"
 			"      Show only devices with the specified vendor and\n"
 			"      product ID numbers (in hexadecimal)\n"
+			"  --class class\n"
+			"      Show only devices with the specified device or\n"
+			"      interface class (in hexadecimal)\n"
+			"  --speed 1.5|12|480|5000\n"
+			"      Show only devices running at the specified speed\n"
+			"  --path bus-port[.port]...\n"
+			"      Show only the device at the specified port path\n"
+			"  --serial serial\n"
+			"      Show only devices with the specified serial number\n"
+#ifdef OS_LINUX
+			"  --driver driver\n"
+			"      Show only devices with an interface bound to the\n"
+			"      specified driver\n"
+#endif
+			"  Selection options may be repeated to show the devices\n"
+			"  matching any of the values\n"
 #ifdef OS_LINUX
 			"  -D /dev/bus/usb/busnum/devnum\n"
 			"      Selects which device lsusb will examine\n"
 #endif
 			"  -t, --tree\n"
 			"      Dump the physical USB device hierarchy as a tree\n"
+			"  -r, --read-only\n"
+			"      Do not open devices; descriptors come from what\n"
+			"      the kernel cached, so no device is ever woken\n"
+			"  --wake\n"
+			"      Open suspended devices too, which resumes them\n"
+			"  -j, --jobs N\n"
+			"      Dump up to N devices at a time with -v\n"
+			"  --json\n"
+			"      Write the listing, -v or -t output as JSON\n"
+			"  --save file\n"
+			"      Also record in file what was read from the devices\n"
+			"  --load file\n"
+			"      Show the devices recorded in file by --save\n"
+			"  --diff old [new]\n"
+			"      Show what changed between two --save files, or\n"
+			"      between one and the devices attached now\n"
+			"  --timing[=file]\n"
+			"      Show where the time went, per phase and device,\n"
+			"      and write a trace of every timed step to file\n"
+			"  --stats\n"
+			"      Count the control requests sent to the devices,\n"
+			"      with retries, errors and latencies, per kind and device\n"
+			"  --watch\n"
+			"      List the devices, then show them as they are\n"
+			"      added and removed\n"
+#ifdef OS_LINUX
+			"  --devices\n"
+			"      Show the devices as the usb-devices script does\n"
+#endif
 			"  -V, --version\n"
 			"      Show version of program\n"
 			"  -h, --help\n"
@@ -4235,36 +5061,92 @@ int main(int argc, char *argv[])
 	}
 
 
+#ifdef OS_LINUX
+	config_cache_use_sysfs(readonly);
+	/* a made up sysfs for tests and benchmarks, see gen-usb-sysfs.py */
+	cp = getenv("LSUSB_SYSROOT");
+	if (cp && *cp && sysfs_set_root(cp) < 0)
+		return EXIT_FAILURE;
+	if (devices)
+		return lsusb_devices();
+#endif
+
 	/* by default, print names as well as numbers */
 	if (names_init() < 0)
 		fprintf(stderr, "unable to initialize usb spec");
 
 	status = 0;
 
-	if (treemode) {
+	if (timing && timing_begin(tracefile) < 0)
+		return EXIT_FAILURE;
+
+	if (treemode && !json) {
 		/* treemode requires at least verblevel 1 */
 		verblevel += 1 - VERBLEVEL_DEFAULT;
-		status = lsusb_t();
-		names_exit();
-		return status;
 	}
 
-	err = libusb_init(&ctx);
-	if (err) {
-		fprintf(stderr, "unable to initialize libusb: %i\n", err);
-		return EXIT_FAILURE;
+	if (loadfile) {
+		/* the snapshot stands in for libusb */
+		if (snapshot_load(loadfile) < 0)
+			return EXIT_FAILURE;
+		ctx = NULL;
+	} else if (diffnew) {
+		/* two files, no bus */
+		ctx = NULL;
+	} else {
+#ifdef HAVE_LIBUSB_WRAP_SYS_DEVICE
+		if (devdump)
+			devfd = open_usb_node(devdump);
+#endif
+		/*
+		 * only verbose dumps talk to the devices long enough to be worth
+		 * it; a snapshot being saved, timing and statistics live in this
+		 * process
+		 */
+		if (jobs > 1 && verblevel > 0 && !treemode && !json && !devdump &&
+		    !watch && !diffold && !savefile && !timing_enabled &&
+		    !xfer_stats_enabled)
+			start_workers(jobs);
+		err = libusb_init(&ctx);
+		if (err) {
+			fprintf(stderr, "unable to initialize libusb: %i\n", err);
+			return EXIT_FAILURE;
+		}
 	}
-
+	xfer_init(ctx);
+	if (savefile)
+		snapshot_record_start();
+
+	if (diffold)
+		status = lsusb_diff(ctx, diffold, diffnew);
+	else if (watch)
+		status = lsusb_watch(ctx);
 #ifdef OS_LINUX
-	if (devdump)
-		status = dump_one_device(ctx, devdump);
+	else if (devdump)
+		status = dump_one_device(ctx, devdump, devfd);
 	else
-		status = list_devices(ctx, bus, devnum, vendor, product);
+		status = render_devices(ctx, treemode, json, savefile);
 #else
-	status = list_devices(ctx, bus, devnum, vendor, product);
+	else
+		status = render_devices(ctx, treemode, json, savefile);
 #endif
 
+	stop_workers();
+	filter_free();
+	config_cache_release_all();
+	string_cache_release_all();
+#ifdef OS_LINUX
+	sysfs_dev_release_all();
+#endif
 	names_exit();
-	libusb_exit(ctx);
+	if (loadfile)
+		snapshot_unload();
+	else if (ctx)
+		libusb_exit(ctx);
+	if (devfd >= 0)
+		close(devfd);
+	report_asleep();
+	xfer_stats_print();
+	timing_end();
 	return status;
 }
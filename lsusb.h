@@ -1,6 +1,81 @@
 #ifndef _LSUSB_H
 #define _LSUSB_H
 
-extern int lsusb_t(void);
+#include <libusb.h>
+
+#include "list.h"
+
+#define CTRL_TIMEOUT	(5*1000)	/* milliseconds */
+
+#define	HUB_STATUS_BYTELEN	3	/* max 3 bytes status = hub + 23 ports */
+#define	HUB_DESC_BYTELEN	(7 /* base descriptor */ \
+				+ 2 /* bitmasks */ * HUB_STATUS_BYTELEN)
+#define	BOS_DESC_BYTELEN	43	/* all known device capabilities */
+
+/* one per device, see lsusb-model.c */
+struct usbdevice {
+	struct list_head list;		/* siblings below the same hub */
+	struct list_head children;
+	struct usbdevice *parent;	/* NULL for a root hub */
+	libusb_device *dev;
+	struct libusb_device_descriptor desc;
+	unsigned int busnum, devnum;
+	unsigned int location_id;
+	unsigned int depth;		/* 0 for a root hub */
+	int speed;
+	int selected;			/* matches the selection options */
+	char *name;			/* resolved once by lsusb --watch */
+};
+
+struct usbmodel {
+	struct usbdevice **devices;	/* in enumeration order */
+	unsigned int ndevices, size;
+	struct list_head roots;		/* root hubs, highest bus first */
+};
+
+extern int usbmodel_build(struct usbmodel *m, libusb_context *ctx);
+extern void usbmodel_free(struct usbmodel *m);
+extern struct usbdevice *usbmodel_add(struct usbmodel *m, libusb_device *dev);
+extern struct usbdevice *usbmodel_find(const struct usbmodel *m, libusb_device *dev);
+extern void usbmodel_remove(struct usbmodel *m, struct usbdevice *d);
+
+/* device handles and names for the renderers, from lsusb.c */
+extern libusb_device_handle *open_device(libusb_device *dev);
+extern void close_device(libusb_device_handle *udev);
+extern void prefetch_dump(libusb_device *dev, libusb_device_handle *udev,
+			  const struct libusb_device_descriptor *desc);
+
+#define LISTING_NAME_LEN	128
+extern void get_listing_names(libusb_device *dev, const struct libusb_device_descriptor *desc,
+			      char *vendor, char *product);
+
+/* renderers */
+extern int lsusb_t(const struct usbmodel *m);
+extern int lsusb_json(const struct usbmodel *m, int verbose, int treemode);
+
+/* lsusb --diff, see lsusb-diff.c */
+extern int lsusb_diff(libusb_context *ctx, const char *oldpath, const char *newpath);
+
+/* lsusb --watch, see lsusb-watch.c */
+extern int lsusb_watch(libusb_context *ctx);
+
+/* lsusb --devices, see lsusb-devices.c */
+extern int lsusb_devices(void);
+
+/* cheapest to check first */
+enum filter_kind {
+	FILTER_BUSDEV,		/* -s */
+	FILTER_VENDOR,		/* -d */
+	FILTER_SPEED,		/* --speed */
+	FILTER_PATH,		/* --path */
+	FILTER_SERIAL,		/* --serial */
+	FILTER_CLASS,		/* --class */
+	FILTER_DRIVER,		/* --driver */
+	FILTER_NKINDS
+};
+
+extern int filter_add(enum filter_kind kind, const char *arg);
+extern int filter_match(libusb_device *dev, const struct libusb_device_descriptor *desc);
+extern void filter_free(void);
 
 #endif
@@ -0,0 +1,118 @@
+/*****************************************************************************/
+
+/*
+ *      names-hashgen.c  --  build time generator for the name lookup tables
+ *
+ *      Emits names-hash.h, a perfect hash index over every table in
+ *      usb-spec.h and usb-vendors.h, so that lsusb does not have to link
+ *      anything together at startup.
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "phash.h"
+#include "usb-spec.h"
+#include "usb-vendors.h"
+
+static int emit_array(const char *name, const char *suffix,
+		      unsigned int n, const u_int16_t *v16, const u_int32_t *v32)
+{
+	unsigned int i;
+
+	printf("static const u_int16_t %s_%s[%u] = {", name, suffix, n);
+	for (i = 0; i < n; i++) {
+		unsigned int v = v16 ? v16[i] : v32[i];
+
+		if (v > 0xffff) {
+			fprintf(stderr, "names-hashgen: %s too large\n", name);
+			return -1;
+		}
+		printf("%s%u,", (i % 12) ? " " : "\n\t", v);
+	}
+	printf("\n};\n");
+	return 0;
+}
+
+static int emit_index(const char *name, const unsigned int *keys, unsigned int n)
+{
+	struct phash_table t;
+
+	if (phash_build(&t, keys, n)) {
+		fprintf(stderr, "names-hashgen: cannot build index for %s\n", name);
+		return -1;
+	}
+	if (t.dups)
+		fprintf(stderr, "names-hashgen: %s: %u duplicate entries ignored\n",
+			name, t.dups);
+
+	printf("\n/* %s: %u entries, %u buckets, %u slots */\n",
+	       name, n - t.dups, t.nbuckets, t.nslots);
+	if (emit_array(name, "disp", t.nbuckets, t.disp, NULL) ||
+	    emit_array(name, "slot", t.nslots, NULL, t.slot)) {
+		phash_free(&t);
+		return -1;
+	}
+	printf("static const struct phash_index %s_index = {\n"
+	       "\t%s_disp, %u, %s_slot, %u\n};\n",
+	       name, name, t.nbuckets, name, t.nslots);
+	phash_free(&t);
+	return 0;
+}
+
+#define INDEX_TABLE(array, field) do { \
+	unsigned int i, n, *keys; \
+	for (n = 0; array[n].name; n++) \
+		; \
+	keys = malloc((n ? n : 1) * sizeof(*keys)); \
+	if (!keys) \
+		return EXIT_FAILURE; \
+	for (i = 0; i < n; i++) \
+		keys[i] = array[i].field; \
+	if (emit_index(#array, keys, n) < 0) \
+		r = EXIT_FAILURE; \
+	free(keys); \
+} while (0)
+
+int main(void)
+{
+	int r = EXIT_SUCCESS;
+
+	printf("/* generated by names-hashgen from usb-spec.h and usb-vendors.h,"
+	       " do not edit */\n\n"
+	       "#ifndef _NAMES_HASH_H\n"
+	       "#define _NAMES_HASH_H\n\n"
+	       "#include \"phash.h\"\n");
+
+	INDEX_TABLE(audioterminals, termt);
+	INDEX_TABLE(videoterminals, termt);
+	INDEX_TABLE(hiddescriptors, num);
+	INDEX_TABLE(reports, num);
+	INDEX_TABLE(huts, num);
+	INDEX_TABLE(hutus, num);
+	INDEX_TABLE(langids, num);
+	INDEX_TABLE(physdess, num);
+	INDEX_TABLE(biass, num);
+	INDEX_TABLE(countrycodes, num);
+	INDEX_TABLE(classes, num);
+	INDEX_TABLE(subclasses, num);
+	INDEX_TABLE(protocols, num);
+	INDEX_TABLE(vendors, num);
+
+	printf("\n#endif /* _NAMES_HASH_H */\n");
+	return r;
+}
@@ -34,6 +34,7 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <sys/mman.h>
 
 #ifdef USE_UDEV
 #include <libudev.h>
@@ -41,114 +42,279 @@
 
 #include "usb-spec.h"
 #include "usb-vendors.h"
+#include "names-hash.h"
+#include "usbids.h"
 #include "names.h"
+#include "snapshot.h"
+#include "timing.h"
 #include "usbmisc.h"
 
-
-#define HASH1  0x10
-#define HASH2  0x02
-#define HASHSZ 512
-
-static unsigned int hashnum(unsigned int num)
-{
-	unsigned int mask1 = HASH1 << 27, mask2 = HASH2 << 27;
-
-	for (; mask1 >= HASH1; mask1 >>= 1, mask2 >>= 1)
-		if (num & mask1)
-			num ^= mask2;
-	return num & (HASHSZ-1);
-}
-
 /* ---------------------------------------------------------------------- */
 
 #ifdef USE_UDEV
 static struct udev *udev = NULL;
 static struct udev_hwdb *hwdb = NULL;
 #endif
-static struct audioterminal *audioterminals_hash[HASHSZ] = { NULL, };
-static struct videoterminal *videoterminals_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *hiddescriptors_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *reports_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *huts_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *biass_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *physdess_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *hutus_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *langids_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *countrycodes_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *classes_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *subclasses_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *protocols_hash[HASHSZ] = { NULL, };
-static struct genericstrtable *vendors_hash[HASHSZ] = { NULL, };
+static const struct usbids_header *usbids = NULL;
+
+/* ---------------------------------------------------------------------- */
 
+#define USBIDS_PTR(off)	((const void *)((const char *)usbids + (off)))
+
+static int usbids_range_ok(u_int32_t off, u_int32_t n, size_t elem)
+{
+	return !(off & 3) && (u_int64_t)off + (u_int64_t)n * elem <= usbids->size;
+}
+
+/* map the compiled usb.ids; only the header is checked, nothing is parsed */
+static void usbids_map(void)
+{
+	struct stat st;
+	void *p;
+	int fd, i;
+
+	fd = open(USBIDS_INDEX_FILE, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+	if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(*usbids) ||
+	    st.st_size > 0x7fffffff) {
+		close(fd);
+		return;
+	}
+	p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED)
+		return;
+	usbids = p;
+
+	if (usbids->magic != USBIDS_MAGIC || usbids->version != USBIDS_VERSION ||
+	    usbids->size != st.st_size || usbids->nsections != USBIDS_NSECTIONS ||
+	    ((const char *)usbids)[usbids->size - 1] != 0)
+		goto bad;
+	for (i = 0; i < USBIDS_NSECTIONS; i++) {
+		const struct usbids_section *s = &usbids->section[i];
+
+		if (!usbids_range_ok(s->entries, s->nentries, sizeof(struct usbids_entry)) ||
+		    !usbids_range_ok(s->disp, s->nbuckets, sizeof(u_int16_t)) ||
+		    !usbids_range_ok(s->slot, s->nslots, sizeof(u_int32_t)) ||
+		    !s->nbuckets || (s->nbuckets & (s->nbuckets - 1)) ||
+		    !s->nslots || (s->nslots & (s->nslots - 1)))
+			goto bad;
+	}
+	return;
+bad:
+	fprintf(stderr, "%s: bad index, ignored\n", USBIDS_INDEX_FILE);
+	munmap(p, st.st_size);
+	usbids = NULL;
+}
+
+static const char *usbids_lookup(enum usbids_section_id id, unsigned int key)
+{
+	const struct usbids_section *s;
+	const struct usbids_entry *e;
+	const u_int32_t *slot;
+	unsigned int i;
+
+	if (!usbids)
+		return NULL;
+	s = &usbids->section[id];
+	if (!s->nentries)
+		return NULL;
+	slot = USBIDS_PTR(s->slot);
+	i = slot[phash_slot(USBIDS_PTR(s->disp), s->nbuckets, s->nslots, key)];
+	if (!i || i > s->nentries)
+		return NULL;
+	e = (const struct usbids_entry *)USBIDS_PTR(s->entries) + i - 1;
+	if (e->key != key || e->name >= usbids->size)
+		return NULL;
+	return USBIDS_PTR(e->name);
+}
 
 /* ---------------------------------------------------------------------- */
 
-static const char *names_genericstrtable(struct genericstrtable *t[HASHSZ],
+/* the compiled usb.ids is newer than the built-in tables, so it goes first */
+static const char *names_genericstrtable(enum usbids_section_id id,
+					 const struct genericstrtable *t,
+					 const struct phash_index *ix,
 					 unsigned int idx)
 {
-	struct genericstrtable *h;
+	const char *name = usbids_lookup(id, idx);
+	unsigned int i;
 
-	for (h = t[hashnum(idx)]; h; h = h->next)
-		if (h->num == idx)
-			return h->name;
+	if (name)
+		return name;
+	i = phash_find(ix, idx);
+
+	if (i && t[i - 1].num == idx)
+		return t[i - 1].name;
 	return NULL;
 }
 
 const char *names_hid(u_int8_t hidd)
 {
-	return names_genericstrtable(hiddescriptors_hash, hidd);
+	return names_genericstrtable(USBIDS_HID, hiddescriptors, &hiddescriptors_index, hidd);
 }
 
 const char *names_reporttag(u_int8_t rt)
 {
-	return names_genericstrtable(reports_hash, rt);
+	return names_genericstrtable(USBIDS_REPORT, reports, &reports_index, rt);
 }
 
 const char *names_huts(unsigned int data)
 {
-	return names_genericstrtable(huts_hash, data);
+	return names_genericstrtable(USBIDS_HUT, huts, &huts_index, data);
 }
 
 const char *names_hutus(unsigned int data)
 {
-	return names_genericstrtable(hutus_hash, data);
+	return names_genericstrtable(USBIDS_HUTUS, hutus, &hutus_index, data);
 }
 
 const char *names_langid(u_int16_t langid)
 {
-	return names_genericstrtable(langids_hash, langid);
+	return names_genericstrtable(USBIDS_LANGID, langids, &langids_index, langid);
 }
 
 const char *names_physdes(u_int8_t ph)
 {
-	return names_genericstrtable(physdess_hash, ph);
+	return names_genericstrtable(USBIDS_PHYSDES, physdess, &physdess_index, ph);
 }
 
 const char *names_bias(u_int8_t b)
 {
-	return names_genericstrtable(biass_hash, b);
+	return names_genericstrtable(USBIDS_BIAS, biass, &biass_index, b);
 }
 
 const char *names_countrycode(unsigned int countrycode)
 {
-	return names_genericstrtable(countrycodes_hash, countrycode);
+	return names_genericstrtable(USBIDS_COUNTRYCODE, countrycodes, &countrycodes_index, countrycode);
+}
+
+const char *names_vendor(u_int16_t vendorid)
+{
+	return names_genericstrtable(USBIDS_VENDOR, vendors, &vendors_index, vendorid);
+}
+
+/* products are only known from the compiled usb.ids */
+const char *names_product(u_int16_t vendorid, u_int16_t productid)
+{
+	return usbids_lookup(USBIDS_PRODUCT, ((unsigned int)vendorid << 16) | productid);
 }
 
+/* ---------------------------------------------------------------------- */
+
 #ifdef USE_UDEV
-static const char *hwdb_get(const char *modalias, const char *key)
+/*
+ * hwdb answers are cached per run: the first query for a vendor/product
+ * pair copies every property the hwdb has for it, later queries for the
+ * same pair (identical devices, or listing and then dumping a device)
+ * are served from here.
+ */
+
+#define HWDB_HASHSZ 64
+
+struct hwdb_prop {
+	char *key;
+	char *value;
+};
+
+struct hwdb_entry {
+	struct hwdb_entry *next;
+	u_int16_t vendorid, productid;
+	unsigned int nprops;
+	struct hwdb_prop *props;
+};
+
+static struct hwdb_entry *hwdb_cache[HWDB_HASHSZ];
+
+static struct hwdb_entry *hwdb_resolve(u_int16_t vendorid, u_int16_t productid)
+{
+	unsigned int h = phash(((unsigned int)vendorid << 16) | productid, 0) & (HWDB_HASHSZ - 1);
+	struct udev_list_entry *first, *entry;
+	struct hwdb_entry *e;
+	char modalias[64];
+	unsigned int n = 0;
+
+	for (e = hwdb_cache[h]; e; e = e->next)
+		if (e->vendorid == vendorid && e->productid == productid)
+			return e;
+
+	if (!hwdb)
+		return NULL;
+	e = calloc(1, sizeof(*e));
+	if (!e)
+		return NULL;
+	e->vendorid = vendorid;
+	e->productid = productid;
+
+	/* also matches the vendor-only records, so one query gets both */
+	snprintf(modalias, sizeof(modalias), "usb:v%04Xp%04X*", vendorid, productid);
+	first = udev_hwdb_get_properties_list_entry(hwdb, modalias, 0);
+	udev_list_entry_foreach(entry, first)
+		n++;
+	if (n)
+		e->props = calloc(n, sizeof(*e->props));
+	if (e->props) {
+		udev_list_entry_foreach(entry, first) {
+			const char *value = udev_list_entry_get_value(entry);
+			struct hwdb_prop *p = &e->props[e->nprops];
+
+			p->key = strdup(udev_list_entry_get_name(entry));
+			p->value = strdup(value ? value : "");
+			if (!p->key || !p->value) {
+				free(p->key);
+				free(p->value);
+				break;
+			}
+			e->nprops++;
+		}
+	}
+
+	/* negative answers are cached too */
+	e->next = hwdb_cache[h];
+	hwdb_cache[h] = e;
+	return e;
+}
+
+static void hwdb_cache_free(void)
 {
-	struct udev_list_entry *entry;
+	struct hwdb_entry *e, *next;
+	unsigned int h, i;
+
+	for (h = 0; h < HWDB_HASHSZ; h++) {
+		for (e = hwdb_cache[h]; e; e = next) {
+			next = e->next;
+			for (i = 0; i < e->nprops; i++) {
+				free(e->props[i].key);
+				free(e->props[i].value);
+			}
+			free(e->props);
+			free(e);
+		}
+		hwdb_cache[h] = NULL;
+	}
+}
+#endif
 
-	udev_list_entry_foreach(entry, udev_hwdb_get_properties_list_entry(hwdb, modalias, 0))
-		if (strcmp(udev_list_entry_get_name(entry), key) == 0)
-			return udev_list_entry_get_value(entry);
+/* any hwdb property (ID_VENDOR_FROM_DATABASE, ID_MODEL_FROM_DATABASE, ...) */
+const char *names_hwdb(u_int16_t vendorid, u_int16_t productid, const char *key)
+{
+#ifdef USE_UDEV
+	struct hwdb_entry *e = hwdb_resolve(vendorid, productid);
+	unsigned int i;
 
+	if (e)
+		for (i = 0; i < e->nprops; i++)
+			if (strcmp(e->props[i].key, key) == 0)
+				return e->props[i].value;
+#endif
 	return NULL;
 }
-#endif
 
+/* ---------------------------------------------------------------------- */
 
-int get_vendor_string(char *buf, size_t size, libusb_device *dev)
+
+static int vendor_string(char *buf, size_t size, libusb_device *dev)
 {
 	/* return value is length of string in buf */
 
@@ -160,23 +326,20 @@ int get_vendor_string(char *buf, size_t size, libusb_device *dev)
 		return 0;
 	*buf = 0;
 
-	libusb_get_device_descriptor(dev, &desc);
+	usbdev_get_device_descriptor(dev, &desc);
 	vendorid = desc.idVendor;
 #ifdef USE_UDEV
-	char modalias[64];
-	sprintf(modalias, "usb:v%04Xp%04X*", vendorid);
-	return snprintf(buf, size, "%s", hwdb_get(modalias, "ID_VENDOR_FROM_DATABASE"));
+	vendorName = names_hwdb(vendorid, desc.idProduct, "ID_VENDOR_FROM_DATABASE");
+	if (vendorName)
+		return snprintf(buf, size, "%s", vendorName);
 #endif
 	/* since iManufacturer theoretically gives the OEM and the vendorID gives the vendor, try the lookup table first */
-	vendorName = names_genericstrtable(vendors_hash, vendorid);
-	int r = snprintf(buf, size, "%s", vendorName);
-	if (r > 0)
-		return r;
+	vendorName = names_vendor(vendorid);
+	if (vendorName)
+		return snprintf(buf, size, "%s", vendorName);
 #ifdef OS_LINUX
 	/* lookup failed, so try to get name from /sys/bus/usb/devices */
-	char *tmp;
-	get_string_from_cache(tmp, 128, dev, LIBUSB_DEVICE_S_MANUFACTURER);
-	return snprintf(buf, size, "%s", tmp);
+	return get_string_from_cache(buf, size, dev, LIBUSB_DEVICE_S_MANUFACTURER);
 #endif
 #ifdef OS_DARWIN
 	/* lookup failed, so try to get name from IORegistry */
@@ -197,29 +360,28 @@ int get_vendor_string(char *buf, size_t size, libusb_device *dev)
 
 /* get_product_string
  * Use the device descriptor to try to find the name of the product.
- * If USE_UDEV is defined, then look in the udev hardware database.
- * If USE_UDEV is undefined and hdev is NULL, return a null string.
- * If USE_UDEV is undefined but hdev is passed, return the iProduct string.
+ * If USE_UDEV is defined, look in the udev hardware database first.
+ * Then look in the compiled usb.ids.
+ * If neither knows the product, return the iProduct string.
  * return value is length of string in buf */
 
-int get_product_string(char *buf, size_t size, libusb_device *dev)
+static int product_string(char *buf, size_t size, libusb_device *dev)
 {
 	struct libusb_device_descriptor desc;
-	
+	const char *name;
+
 	if (size < 1)
 		return 0;
 	*buf = 0;
+	usbdev_get_device_descriptor(dev, &desc);
 #ifdef USE_UDEV
-	u_int16_t vendorid, productid;
-
-	libusb_get_device_descriptor(dev, &desc);
-	vendorid = desc.idVendor;
-	productid = desc.idProduct;
-	char modalias[64];
-	sprintf(modalias, "usb:v%04Xp%04X*", vendorid, productid);
-	strncpy(buf, hwdb_get(modalias, "ID_MODEL_FROM_DATABASE"), 128);
-	return strlen(buf);
+	name = names_hwdb(desc.idVendor, desc.idProduct, "ID_MODEL_FROM_DATABASE");
+	if (name)
+		return snprintf(buf, size, "%s", name);
 #endif
+	name = names_product(desc.idVendor, desc.idProduct);
+	if (name)
+		return snprintf(buf, size, "%s", name);
 #ifdef OS_LINUX
 	/* try to get name from /sys/bus/usb/devices */
 	get_string_from_cache(buf, 128, dev, LIBUSB_DEVICE_S_PRODUCT);
@@ -235,53 +397,78 @@ int get_product_string(char *buf, size_t size, libusb_device *dev)
 	if (dev) {
 		int r;
 		libusb_device_handle *hdev;
-		if (libusb_open(dev,&hdev) != LIBUSB_SUCCESS )
+		if (usbdev_open(dev,&hdev) != LIBUSB_SUCCESS )
 			return 0;
-		if (libusb_get_device_descriptor(dev, &desc) != LIBUSB_SUCCESS)
-			return 0;
-		get_dev_string(buf, size, hdev, desc.iProduct);
-		libusb_close(hdev);
+		if (usbdev_get_device_descriptor(dev, &desc) == LIBUSB_SUCCESS)
+			get_dev_string(buf, size, hdev, desc.iProduct);
+		/* as close_device() does: the strings are cached per handle */
+		free_dev_strings(hdev);
+		usbdev_close(hdev);
 		return strlen(buf);
 	}
 	return 0;
 }
 
+int get_vendor_string(char *buf, size_t size, libusb_device *dev)
+{
+	u_int64_t start = timing_start();
+	int r = vendor_string(buf, size, dev);
+
+	if (start)
+		timing_record(TIMING_NAMES, "vendor", 0, get_location_id(dev), start);
+	return r;
+}
+
+int get_product_string(char *buf, size_t size, libusb_device *dev)
+{
+	u_int64_t start = timing_start();
+	int r = product_string(buf, size, dev);
+
+	if (start)
+		timing_record(TIMING_NAMES, "product", 0, get_location_id(dev), start);
+	return r;
+}
+
 const char *names_class(u_int8_t classid)
 {
-	return names_genericstrtable(classes_hash, classid);
+	return names_genericstrtable(USBIDS_CLASS, classes, &classes_index, classid);
 }
 
 const char *names_subclass(u_int8_t classid, u_int8_t subclassid)
 {
 	u_int16_t subclass = ( classid << 8 ) + subclassid;
-	return names_genericstrtable(subclasses_hash, subclass);
+	return names_genericstrtable(USBIDS_SUBCLASS, subclasses, &subclasses_index, subclass);
 }
 
 const char *names_protocol(u_int8_t classid, u_int8_t subclassid, u_int8_t protocolid)
 {
 	unsigned int protocol = ( classid << 16 ) + ( subclassid << 8 ) + protocolid;
-	return names_genericstrtable(protocols_hash, protocol);
+	return names_genericstrtable(USBIDS_PROTOCOL, protocols, &protocols_index, protocol);
 }
 
 const char *names_audioterminal(u_int16_t termt)
 {
-	struct audioterminal *at;
-
-	at = audioterminals_hash[hashnum(termt)];
-	for (; at; at = at->next)
-		if (at->termt == termt)
-			return at->name;
+	const char *name = usbids_lookup(USBIDS_AUDIOTERMINAL, termt);
+	unsigned int i;
+
+	if (name)
+		return name;
+	i = phash_find(&audioterminals_index, termt);
+	if (i && audioterminals[i - 1].termt == termt)
+		return audioterminals[i - 1].name;
 	return NULL;
 }
 
 const char *names_videoterminal(u_int16_t termt)
 {
-	struct videoterminal *vt;
-
-	vt = videoterminals_hash[hashnum(termt)];
-	for (; vt; vt = vt->next)
-		if (vt->termt == termt)
-			return vt->name;
+	const char *name = usbids_lookup(USBIDS_VIDEOTERMINAL, termt);
+	unsigned int i;
+
+	if (name)
+		return name;
+	i = phash_find(&videoterminals_index, termt);
+	if (i && videoterminals[i - 1].termt == termt)
+		return videoterminals[i - 1].name;
 	return NULL;
 }
 
@@ -314,238 +501,9 @@ int get_subclass_string(char *buf, size_t size, u_int8_t cls, u_int8_t subcls)
 
 /* ---------------------------------------------------------------------- */
 
-static int hash_audioterminal(struct audioterminal *at)
-{
-	struct audioterminal *at_old;
-	unsigned int h = hashnum(at->termt);
-
-	for (at_old = audioterminals_hash[h]; at_old; at_old = at_old->next)
-		if (at_old->termt == at->termt)
-			return -1;
-	at->next = audioterminals_hash[h];
-	audioterminals_hash[h] = at;
-	return 0;
-}
-
-static int hash_audioterminals(void)
-{
-	int r = 0, i, k;
-
-	for (i = 0; audioterminals[i].name; i++)
-	{
-		k = hash_audioterminal(&audioterminals[i]);
-		if (k < 0)
-			r = k;
-	}
-
-	return r;
-}
-
-static int hash_videoterminal(struct videoterminal *vt)
-{
-	struct videoterminal *vt_old;
-	unsigned int h = hashnum(vt->termt);
-
-	for (vt_old = videoterminals_hash[h]; vt_old; vt_old = vt_old->next)
-		if (vt_old->termt == vt->termt)
-			return -1;
-	vt->next = videoterminals_hash[h];
-	videoterminals_hash[h] = vt;
-	return 0;
-}
-
-static int hash_videoterminals(void)
-{
-	int r = 0, i, k;
-
-	for (i = 0; videoterminals[i].name; i++)
-	{
-		k = hash_videoterminal(&videoterminals[i]);
-		if (k < 0)
-			r = k;
-	}
-
-	return r;
-}
-
-static int hash_genericstrtable(struct genericstrtable *t[HASHSZ],
-			       struct genericstrtable *g)
-{
-	struct genericstrtable *g_old;
-	unsigned int h = hashnum(g->num);
-
-	for (g_old = t[h]; g_old; g_old = g_old->next)
-		if (g_old->num == g->num)
-			return -1;
-	g->next = t[h];
-	t[h] = g;
-	return 0;
-}
-
-#define HASH_EACH(array, hash) \
-	for (i = 0; array[i].name; i++) { \
-		k = hash_genericstrtable(hash, &array[i]); \
-		if (k < 0) { \
-			r = k; \
-		}\
-	}
-
-static int hash_tables(void)
-{
-	int r = 0, k, i;
-
-	k = hash_audioterminals();
-	if (k < 0)
-		r = k;
-
-	k = hash_videoterminals();
-	if (k < 0)
-		r = k;
-
-	HASH_EACH(hiddescriptors, hiddescriptors_hash);
-
-	HASH_EACH(reports, reports_hash);
-
-	HASH_EACH(huts, huts_hash);
-
-	HASH_EACH(hutus, hutus_hash);
-
-	HASH_EACH(langids, langids_hash);
-
-	HASH_EACH(physdess, physdess_hash);
-
-	HASH_EACH(biass, biass_hash);
-
-	HASH_EACH(countrycodes, countrycodes_hash);
-
-	HASH_EACH(classes, classes_hash);
-
-	HASH_EACH(subclasses, subclasses_hash);
-
-	HASH_EACH(protocols, protocols_hash);
-
-	HASH_EACH(vendors, vendors_hash);
-
-	return r;
-}
-
-/* ---------------------------------------------------------------------- */
-
-/*
-static void print_tables(void)
-{
-	int i;
-	struct audioterminal *at;
-	struct videoterminal *vt;
-	struct genericstrtable *li;
-	struct genericstrtable *hu;
-	struct genericstrtable *cl;
-	struct genericstrtable *sc;
-	struct genericstrtable *pr;
-	struct genericstrtable *ve;
-
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Audio Terminals\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		printf("hash: %d\n", i);
-		at = audioterminals_hash[i];
-		for (; at; at = at->next)
-			printf("\tentry: %s\n", at->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Video Terminals\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		printf("hash: %d\n", i);
-		vt = videoterminals_hash[i];
-		for (; vt; vt = vt->next)
-			printf("\tentry: %s\n", vt->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Languages\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		li = langids_hash[i];
-		if (li)
-			printf("hash: %d\n", i);
-		for (; li; li = li->next)
-			printf("\tid: %x, entry: %s\n", li->num, li->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Country Codes\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		hu = countrycodes_hash[i];
-		if (hu)
-			printf("hash: %d\n", i);
-		for (; hu; hu = hu->next)
-			printf("\tid: %x, entry: %s\n", hu->num, hu->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Classes\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		cl = classes_hash[i];
-		if (cl)
-			printf("hash: %d\n", i);
-		for (; cl; cl = cl->next)
-			printf("\tid: %x, entry: %s\n", cl->num, cl->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Subclasses\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		sc = subclasses_hash[i];
-		if (sc)
-			printf("hash: %d\n", i);
-		for (; sc; sc = sc->next)
-			printf("\tid: %x, entry: %s\n", sc->num, sc->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Protocols\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		pr = protocols_hash[i];
-		if (pr)
-			printf("hash: %d\n", i);
-		for (; pr; pr = pr->next)
-			printf("\tid: %x, entry: %s\n", pr->num, pr->name);
-	}
-
-	printf("--------------------------------------------\n");
-	printf("\t\t Vendors\n");
-	printf("--------------------------------------------\n");
-
-	for (i = 0; i < HASHSZ; i++) {
-		ve = vendors_hash[i];
-		if (ve)
-			printf("hash: %d\n", i);
-		for (; ve; ve = ve->next)
-			printf("\tid: %x, entry: %s\n", ve->num, ve->name);
-	}
-
-	printf("--------------------------------------------\n");
-}
-*/
-
 int names_init(void)
 {
-	int r;
+	int r = 0;
 
 #ifdef USE_UDEV
 	udev = udev_new();
@@ -557,8 +515,7 @@ int names_init(void)
 			r = -1;
 	}
 #endif
-
-	r = hash_tables();
+	usbids_map();
 
 	return r;
 }
@@ -566,7 +523,11 @@ int names_init(void)
 void names_exit(void)
 {
 #ifdef USE_UDEV
+	hwdb_cache_free();
 	hwdb = udev_hwdb_unref(hwdb);
 	udev = udev_unref(udev);
 #endif
+	if (usbids)
+		munmap((void *)usbids, usbids->size);
+	usbids = NULL;
 }
@@ -32,6 +32,8 @@
 
 /* ---------------------------------------------------------------------- */
 
+extern const char *names_vendor(u_int16_t vendorid);
+extern const char *names_product(u_int16_t vendorid, u_int16_t productid);
 extern const char *names_class(u_int8_t classid);
 extern const char *names_subclass(u_int8_t classid, u_int8_t subclassid);
 extern const char *names_protocol(u_int8_t classid, u_int8_t subclassid,
@@ -46,6 +48,8 @@ extern const char *names_langid(u_int16_t langid);
 extern const char *names_physdes(u_int8_t ph);
 extern const char *names_bias(u_int8_t b);
 extern const char *names_countrycode(unsigned int countrycode);
+extern const char *names_hwdb(u_int16_t vendorid, u_int16_t productid,
+			      const char *key);
 
 extern int get_vendor_string(char *buf, size_t size, struct libusb_device *dev);
 extern int get_product_string(char *buf, size_t size, libusb_device *dev);
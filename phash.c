@@ -0,0 +1,178 @@
+/*****************************************************************************/
+
+/*
+ *      phash.c  --  perfect hash table builder
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "phash.h"
+
+#define PHASH_MAX_SEED	0xffff
+
+static unsigned int roundup_pow2(unsigned int n)
+{
+	unsigned int p = 1;
+
+	while (p < n)
+		p <<= 1;
+	return p;
+}
+
+static unsigned int *sort_keys;
+
+static int cmp_index(const void *a, const void *b)
+{
+	unsigned int ka = sort_keys[*(const unsigned int *)a];
+	unsigned int kb = sort_keys[*(const unsigned int *)b];
+
+	if (ka != kb)
+		return ka < kb ? -1 : 1;
+	/* equal keys: the first entry in the table wins */
+	return *(const unsigned int *)a < *(const unsigned int *)b ? -1 : 1;
+}
+
+/* try to place every bucket, biggest first; 0 on success */
+static int place(struct phash_table *t, const unsigned int *keys,
+		 const unsigned int *idx, unsigned int n)
+{
+	unsigned int *count, *start, *order, *members, *pos;
+	unsigned int b, i, j, k;
+	int r = -1;
+
+	count = calloc(t->nbuckets + 1, sizeof(*count));
+	start = calloc(t->nbuckets + 1, sizeof(*start));
+	order = calloc(t->nbuckets, sizeof(*order));
+	members = calloc(n ? n : 1, sizeof(*members));
+	pos = calloc(n ? n : 1, sizeof(*pos));
+	if (!count || !start || !order || !members || !pos)
+		goto out;
+
+	for (i = 0; i < n; i++)
+		count[phash(keys[idx[i]], 0) & (t->nbuckets - 1)]++;
+	for (b = 0; b < t->nbuckets; b++)
+		start[b + 1] = start[b] + count[b];
+	memset(count, 0, t->nbuckets * sizeof(*count));
+	for (i = 0; i < n; i++) {
+		b = phash(keys[idx[i]], 0) & (t->nbuckets - 1);
+		members[start[b] + count[b]++] = idx[i];
+	}
+
+	/* order buckets by decreasing size, one pass per bucket size */
+	for (b = k = 0; b < t->nbuckets; b++)
+		if (count[b] > k)
+			k = count[b];
+	for (i = 0; k > 0; k--)
+		for (b = 0; b < t->nbuckets; b++)
+			if (count[b] == k)
+				order[i++] = b;
+
+	memset(t->slot, 0, t->nslots * sizeof(*t->slot));
+	memset(t->disp, 0, t->nbuckets * sizeof(*t->disp));
+
+	for (i = 0; i < t->nbuckets && count[order[i]]; i++) {
+		unsigned int seed;
+
+		b = order[i];
+		for (seed = 0; seed <= PHASH_MAX_SEED; seed++) {
+			for (j = 0; j < count[b]; j++) {
+				pos[j] = phash(keys[members[start[b] + j]], seed) &
+					(t->nslots - 1);
+				if (t->slot[pos[j]])
+					break;
+				for (k = 0; k < j; k++)
+					if (pos[k] == pos[j])
+						break;
+				if (k < j)
+					break;
+			}
+			if (j == count[b])
+				break;
+		}
+		if (seed > PHASH_MAX_SEED)
+			goto out;
+		t->disp[b] = seed;
+		for (j = 0; j < count[b]; j++)
+			t->slot[pos[j]] = members[start[b] + j] + 1;
+	}
+	r = 0;
+out:
+	free(count);
+	free(start);
+	free(order);
+	free(members);
+	free(pos);
+	return r;
+}
+
+int phash_build(struct phash_table *t, const unsigned int *keys, unsigned int n)
+{
+	unsigned int *idx;
+	unsigned int i, u;
+	int r = -1;
+
+	memset(t, 0, sizeof(*t));
+	idx = calloc(n ? n : 1, sizeof(*idx));
+	if (!idx)
+		return -1;
+
+	/* drop duplicate keys, keeping the entry that comes first */
+	for (i = 0; i < n; i++)
+		idx[i] = i;
+	sort_keys = (unsigned int *)keys;
+	qsort(idx, n, sizeof(*idx), cmp_index);
+	for (i = u = 0; i < n; i++) {
+		if (u && keys[idx[u - 1]] == keys[idx[i]]) {
+			t->dups++;
+			continue;
+		}
+		idx[u++] = idx[i];
+	}
+
+	t->nslots = roundup_pow2(u + u / 4 + 1);
+	t->nbuckets = roundup_pow2(u / 4 + 1);
+	for (;;) {
+		free(t->disp);
+		free(t->slot);
+		t->disp = calloc(t->nbuckets, sizeof(*t->disp));
+		t->slot = calloc(t->nslots, sizeof(*t->slot));
+		if (!t->disp || !t->slot)
+			break;
+		if (place(t, keys, idx, u) == 0) {
+			r = 0;
+			break;
+		}
+		/* denser buckets failed, spread them out before growing the table */
+		if (t->nbuckets < t->nslots)
+			t->nbuckets <<= 1;
+		else
+			t->nslots <<= 1;
+	}
+	free(idx);
+	if (r)
+		phash_free(t);
+	return r;
+}
+
+void phash_free(struct phash_table *t)
+{
+	free(t->disp);
+	free(t->slot);
+	t->disp = NULL;
+	t->slot = NULL;
+}
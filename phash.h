@@ -0,0 +1,83 @@
+/*****************************************************************************/
+
+/*
+ *      phash.h  --  perfect hash tables for the USB name databases
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifndef _PHASH_H
+#define _PHASH_H
+
+#include <sys/types.h>
+
+/*
+ * "Hash and displace": every key first hashes into a bucket, and each
+ * bucket carries a seed that moves its keys into free slots of the main
+ * table.  A lookup is therefore one displacement read plus one slot read,
+ * with a single key comparison to reject keys that are not in the set.
+ *
+ * Slots hold the index of the entry in the caller's table plus one, so
+ * that zero marks an empty slot.  nbuckets and nslots are powers of two.
+ */
+
+struct phash_index {
+	const u_int16_t *disp;
+	unsigned int nbuckets;
+	const u_int16_t *slot;
+	unsigned int nslots;
+};
+
+static inline unsigned int phash(unsigned int key, unsigned int seed)
+{
+	unsigned int h = key ^ (seed * 0x9e3779b9u);
+
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+static inline unsigned int phash_slot(const u_int16_t *disp, unsigned int nbuckets,
+				      unsigned int nslots, unsigned int key)
+{
+	return phash(key, disp[phash(key, 0) & (nbuckets - 1)]) & (nslots - 1);
+}
+
+/* returns 0 for an empty slot, otherwise the table index plus one */
+static inline unsigned int phash_find(const struct phash_index *ix, unsigned int key)
+{
+	return ix->slot[phash_slot(ix->disp, ix->nbuckets, ix->nslots, key)];
+}
+
+/* ---------------------------------------------------------------------- */
+
+/* builder, only used by the generators */
+
+struct phash_table {
+	unsigned int nbuckets;
+	unsigned int nslots;
+	u_int16_t *disp;
+	u_int32_t *slot;	/* index + 1, or 0 */
+	unsigned int dups;	/* keys that were already present */
+};
+
+extern int phash_build(struct phash_table *t, const unsigned int *keys, unsigned int n);
+extern void phash_free(struct phash_table *t);
+
+/* ---------------------------------------------------------------------- */
+#endif /* _PHASH_H */
@@ -0,0 +1,1100 @@
+/*****************************************************************************/
+
+/*
+ *      snapshot.c  --  saved device state, and device access that can use it
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <libusb.h>
+
+#include "lsusb.h"
+#include "usbmisc.h"
+#include "snapshot.h"
+
+/*
+ * "lsusb --save" records, for every device, what this run learned about
+ * it: the device descriptor and port position, each configuration as raw
+ * bytes, the sysfs attributes and driver bindings, the kernel driver
+ * libusb named per interface, and the answer to every control request
+ * the renderer made (hub and port status, BOS, strings, HID reports...).
+ * "lsusb --load" maps such a file and answers the same questions from
+ * it, so each mode renders as it would have on the recorded host.
+ *
+ * While a snapshot is loaded the libusb_device and libusb_device_handle
+ * pointers handed out point at its device records.  They are only ever
+ * compared or passed back to the usbdev_*() calls, never to libusb.
+ *
+ * The file is a header, a table of fixed size device records, and a data
+ * area the records refer into by file offset (0 for none), all in the
+ * byte order of the host that wrote it.
+ */
+
+#define SNAPSHOT_MAGIC		"lsusbsnp"
+#define SNAPSHOT_VERSION	1
+#define SNAPSHOT_BYTEORDER	0x01020304
+#define SNAPSHOT_NATTRS		32	/* room for the sysfs attributes */
+#define SNAPSHOT_MAXPORTS	8
+
+struct snap_header {
+	char magic[8];
+	u_int32_t version;
+	u_int32_t byteorder;
+	u_int32_t ndevices;
+	u_int32_t size;			/* of the whole file */
+};
+
+struct snap_device {
+	u_int32_t location_id;
+	int32_t speed;
+	u_int8_t busnum, devnum, nports, opened;
+	u_int8_t ports[SNAPSHOT_MAXPORTS];
+	u_int8_t desc[LIBUSB_DT_DEVICE_SIZE];	/* as sent by the device */
+	u_int16_t nconfigs;
+	u_int32_t configs;			/* struct snap_config[nconfigs] */
+	u_int32_t attr[SNAPSHOT_NATTRS];	/* sysfs values, by enum sysfs_attr */
+	u_int32_t drivers, ndrivers;		/* bound per sysfs */
+	u_int32_t kdrivers, nkdrivers;		/* as libusb named them */
+	u_int32_t ctrl, nctrl;
+};
+
+struct snap_config {
+	int32_t ret;			/* what reading it gave */
+	u_int32_t len, data;
+};
+
+struct snap_driver {
+	u_int32_t ifnum;
+	u_int32_t name;
+};
+
+struct snap_ctrl {
+	u_int8_t requesttype, request;
+	u_int16_t value, idx, length;
+	int32_t status;			/* bytes received, or a LIBUSB_ERROR */
+	u_int32_t data;
+};
+
+struct snapshot {
+	const unsigned char *base;
+	size_t size;
+	int mapped;			/* from a file, rather than malloc()ed */
+	const struct snap_device *devs;
+	unsigned int ndevices;
+	const struct snap_device **by_location;
+};
+
+/* the one --load renders from */
+static struct snapshot *loaded;
+
+/* ---------------------------------------------------------------------- */
+
+/* NULL unless len bytes at off are inside the snapshot */
+static const void *snap_ptr(const struct snapshot *s, u_int32_t off, size_t len)
+{
+	if (!off || off > s->size || len > s->size - off)
+		return NULL;
+	return s->base + off;
+}
+
+static const char *snap_str(const struct snapshot *s, u_int32_t off)
+{
+	if (!off || off >= s->size || !memchr(s->base + off, 0, s->size - off))
+		return NULL;
+	return (const char *)s->base + off;
+}
+
+static const struct snap_device *snap_dev(libusb_device *dev)
+{
+	return (const struct snap_device *)dev;
+}
+
+static int cmp_location(const void *a, const void *b)
+{
+	u_int32_t la = (*(const struct snap_device * const *)a)->location_id;
+	u_int32_t lb = (*(const struct snap_device * const *)b)->location_id;
+
+	return la < lb ? -1 : la > lb;
+}
+
+static const struct snap_device *snap_find_location(const struct snapshot *s,
+						    unsigned int location_id)
+{
+	unsigned int lo = 0, hi = s->ndevices;
+
+	while (lo < hi) {
+		unsigned int mid = lo + (hi - lo) / 2;
+
+		if (s->by_location[mid]->location_id < location_id)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < s->ndevices && s->by_location[lo]->location_id == location_id)
+		return s->by_location[lo];
+	return NULL;
+}
+
+static int snap_driver(const struct snapshot *s, u_int32_t off, u_int32_t n,
+		       int ifnum, char *buf, size_t size)
+{
+	const struct snap_driver *drv = snap_ptr(s, off, n * sizeof(*drv));
+	const char *name;
+	u_int32_t i;
+
+	for (i = 0; drv && i < n; i++)
+		if (drv[i].ifnum == (u_int32_t)ifnum && (name = snap_str(s, drv[i].name)))
+			return snprintf(buf, size, "%s", name);
+	return -1;
+}
+
+static void snap_device_desc(const struct snap_device *sd,
+			     struct libusb_device_descriptor *desc)
+{
+	const u_int8_t *d = sd->desc;
+
+	desc->bLength = d[0];
+	desc->bDescriptorType = d[1];
+	desc->bcdUSB = d[2] | (d[3] << 8);
+	desc->bDeviceClass = d[4];
+	desc->bDeviceSubClass = d[5];
+	desc->bDeviceProtocol = d[6];
+	desc->bMaxPacketSize0 = d[7];
+	desc->idVendor = d[8] | (d[9] << 8);
+	desc->idProduct = d[10] | (d[11] << 8);
+	desc->bcdDevice = d[12] | (d[13] << 8);
+	desc->iManufacturer = d[14];
+	desc->iProduct = d[15];
+	desc->iSerialNumber = d[16];
+	desc->bNumConfigurations = d[17];
+}
+
+/* takes over base, which is either mapped or malloc()ed */
+static struct snapshot *snap_init(const unsigned char *base, size_t size, int mapped,
+				  const char *what)
+{
+	const struct snap_header *h = (const struct snap_header *)base;
+	struct snapshot *s;
+	unsigned int i;
+
+	if (size < sizeof(*h) ||
+	    memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) ||
+	    h->size != size ||
+	    h->ndevices > (size - sizeof(*h)) / sizeof(struct snap_device)) {
+		fprintf(stderr, "%s is not an lsusb snapshot\n", what);
+		goto fail;
+	}
+	if (h->byteorder != SNAPSHOT_BYTEORDER || h->version != SNAPSHOT_VERSION) {
+		fprintf(stderr, "%s was written by an incompatible lsusb\n", what);
+		goto fail;
+	}
+
+	s = calloc(1, sizeof(*s));
+	if (s)
+		s->by_location = calloc(h->ndevices ? h->ndevices : 1,
+					sizeof(*s->by_location));
+	if (!s || !s->by_location) {
+		fprintf(stderr, "out of memory\n");
+		free(s);
+		goto fail;
+	}
+	s->base = base;
+	s->size = size;
+	s->mapped = mapped;
+	s->devs = (const struct snap_device *)(h + 1);
+	s->ndevices = h->ndevices;
+
+	/* sysfs values are looked up by location */
+	for (i = 0; i < s->ndevices; i++)
+		s->by_location[i] = &s->devs[i];
+	qsort(s->by_location, s->ndevices, sizeof(*s->by_location), cmp_location);
+	return s;
+
+fail:
+	if (mapped)
+		munmap((void *)base, size);
+	else
+		free((void *)base);
+	return NULL;
+}
+
+struct snapshot *snapshot_open(const char *path)
+{
+	struct stat st;
+	void *base;
+	int fd;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "Couldn't open %s: %s\n", path, strerror(errno));
+		if (fd >= 0)
+			close(fd);
+		return NULL;
+	}
+	if (st.st_size < (off_t)sizeof(struct snap_header)) {
+		fprintf(stderr, "%s is not an lsusb snapshot\n", path);
+		close(fd);
+		return NULL;
+	}
+	base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) {
+		fprintf(stderr, "Couldn't map %s: %s\n", path, strerror(errno));
+		return NULL;
+	}
+	return snap_init(base, st.st_size, 1, path);
+}
+
+void snapshot_close(struct snapshot *s)
+{
+	if (!s)
+		return;
+	free(s->by_location);
+	if (s->mapped)
+		munmap((void *)s->base, s->size);
+	else
+		free((void *)s->base);
+	free(s);
+}
+
+int snapshot_load(const char *path)
+{
+	loaded = snapshot_open(path);
+	return loaded ? 0 : -1;
+}
+
+void snapshot_unload(void)
+{
+	snapshot_close(loaded);
+	loaded = NULL;
+}
+
+int snapshot_loaded(void)
+{
+	return loaded != NULL;
+}
+
+int snapshot_control(libusb_device_handle *hdev, u_int8_t requesttype,
+		     u_int8_t request, u_int16_t value, u_int16_t idx,
+		     unsigned char *data, u_int16_t size)
+{
+	const struct snap_device *sd = snap_dev((libusb_device *)hdev);
+	const struct snap_ctrl *c;
+	const unsigned char *p;
+	u_int32_t i;
+
+	if (!sd)
+		return LIBUSB_ERROR_INVALID_PARAM;
+	c = snap_ptr(loaded, sd->ctrl, sd->nctrl * sizeof(*c));
+
+	for (i = 0; c && i < sd->nctrl; i++, c++) {
+		if (c->requesttype != requesttype || c->request != request ||
+		    c->value != value || c->idx != idx || c->length != size)
+			continue;
+		if (c->status <= 0)
+			return c->status;
+		p = snap_ptr(loaded, c->data, c->status);
+		if (!p || c->status > size)
+			return LIBUSB_ERROR_IO;
+		memcpy(data, p, c->status);
+		return c->status;
+	}
+	/* this run asks for something the recording one did not */
+	return LIBUSB_ERROR_NOT_FOUND;
+}
+
+int snapshot_get_config(libusb_device *dev, int index,
+			struct libusb_config_descriptor **config)
+{
+	const struct snap_device *sd = snap_dev(dev);
+	const struct snap_config *sc = snap_ptr(loaded, sd->configs,
+						sd->nconfigs * sizeof(*sc));
+	const unsigned char *p;
+
+	*config = NULL;
+	if (!sc || index < 0 || index >= sd->nconfigs)
+		return LIBUSB_ERROR_NOT_FOUND;
+	sc += index;
+	if (sc->ret)
+		return sc->ret;
+	p = snap_ptr(loaded, sc->data, sc->len);
+	if (!p || sc->len < LIBUSB_DT_CONFIG_SIZE)
+		return LIBUSB_ERROR_IO;
+	*config = parse_config_descriptor(p, sc->len);
+	return *config ? LIBUSB_SUCCESS : LIBUSB_ERROR_NO_MEM;
+}
+
+const char *snapshot_sysfs_attr(unsigned int location_id, int attr)
+{
+	const struct snap_device *sd = snap_find_location(loaded, location_id);
+
+	if (!sd || attr < 0 || attr >= SNAPSHOT_NATTRS)
+		return NULL;
+	return snap_str(loaded, sd->attr[attr]);
+}
+
+int snapshot_sysfs_driver(unsigned int location_id, int ifnum, char *buf, size_t size)
+{
+	const struct snap_device *sd = snap_find_location(loaded, location_id);
+	int r;
+
+	*buf = 0;
+	if (!sd)
+		return 0;
+	r = snap_driver(loaded, sd->drivers, sd->ndrivers, ifnum, buf, size);
+	return r < 0 ? 0 : r;
+}
+
+/* ---------------------------------------------------------------------- */
+
+/* for comparing snapshots, by device index */
+
+unsigned int snapshot_ndevices(const struct snapshot *s)
+{
+	return s->ndevices;
+}
+
+void snapshot_device(const struct snapshot *s, unsigned int i, struct snapshot_device *d)
+{
+	const struct snap_device *sd = &s->devs[i];
+
+	d->location_id = sd->location_id;
+	d->busnum = sd->busnum;
+	d->devnum = sd->devnum;
+	d->speed = sd->speed;
+	d->nports = sd->nports < SNAPSHOT_MAXPORTS ? sd->nports : SNAPSHOT_MAXPORTS;
+	memcpy(d->ports, sd->ports, d->nports);
+	snap_device_desc(sd, &d->desc);
+	d->nconfigs = sd->nconfigs;
+#ifdef OS_LINUX
+	d->serial = snap_str(s, sd->attr[SYSFS_SERIAL]);
+#else
+	d->serial = NULL;
+#endif
+}
+
+/* what reading configuration index gave, and its bytes if that worked */
+int snapshot_config(const struct snapshot *s, unsigned int i, int index,
+		    const unsigned char **data, unsigned int *len)
+{
+	const struct snap_device *sd = &s->devs[i];
+	const struct snap_config *sc = snap_ptr(s, sd->configs, sd->nconfigs * sizeof(*sc));
+
+	*data = NULL;
+	*len = 0;
+	if (!sc || index < 0 || index >= sd->nconfigs)
+		return LIBUSB_ERROR_NOT_FOUND;
+	sc += index;
+	if (sc->ret)
+		return sc->ret;
+	*data = snap_ptr(s, sc->data, sc->len);
+	if (!*data)
+		return LIBUSB_ERROR_IO;
+	*len = sc->len;
+	return LIBUSB_SUCCESS;
+}
+
+/* the k-th interface driver sysfs showed bound, NULL after the last */
+const char *snapshot_driver(const struct snapshot *s, unsigned int i, unsigned int k,
+			    int *ifnum)
+{
+	const struct snap_device *sd = &s->devs[i];
+	const struct snap_driver *drv = snap_ptr(s, sd->drivers, sd->ndrivers * sizeof(*drv));
+
+	if (!drv || k >= sd->ndrivers)
+		return NULL;
+	*ifnum = drv[k].ifnum;
+	return snap_str(s, drv[k].name);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * While recording, what each device was asked and answered is kept per
+ * libusb_device until snapshot_save() writes it out.
+ */
+
+#define REC_HASHSZ	64
+
+struct rec_ctrl {
+	struct rec_ctrl *next;
+	u_int8_t requesttype, request;
+	u_int16_t value, idx, length;
+	int status;
+	unsigned char data[];
+};
+
+struct rec_driver {
+	struct rec_driver *next;
+	int ifnum;
+	char name[];
+};
+
+struct rec_device {
+	struct rec_device *next;
+	libusb_device *dev;
+	int opened;
+	struct rec_ctrl *ctrl;		/* in the order they were made */
+	struct rec_ctrl **ctrl_tail;
+	unsigned int nctrl;
+	struct rec_driver *kdrivers;
+	unsigned int nkdrivers;
+};
+
+static int recording;
+static struct rec_device *rec_hash[REC_HASHSZ];
+
+static unsigned int rec_hashfn(libusb_device *dev)
+{
+	unsigned long h = (unsigned long)dev;
+
+	return (h ^ (h >> 9)) & (REC_HASHSZ - 1);
+}
+
+static struct rec_device *rec_find(libusb_device *dev, int create)
+{
+	struct rec_device **head = &rec_hash[rec_hashfn(dev)];
+	struct rec_device *rd;
+
+	for (rd = *head; rd; rd = rd->next)
+		if (rd->dev == dev)
+			return rd;
+	if (!create)
+		return NULL;
+	rd = calloc(1, sizeof(*rd));
+	if (!rd)
+		return NULL;
+	rd->dev = dev;
+	rd->ctrl_tail = &rd->ctrl;
+	rd->next = *head;
+	*head = rd;
+	return rd;
+}
+
+static void rec_free_all(void)
+{
+	struct rec_device *rd;
+	struct rec_ctrl *c;
+	struct rec_driver *drv;
+	unsigned int h;
+
+	for (h = 0; h < REC_HASHSZ; h++) {
+		while ((rd = rec_hash[h])) {
+			rec_hash[h] = rd->next;
+			while ((c = rd->ctrl)) {
+				rd->ctrl = c->next;
+				free(c);
+			}
+			while ((drv = rd->kdrivers)) {
+				rd->kdrivers = drv->next;
+				free(drv);
+			}
+			free(rd);
+		}
+	}
+}
+
+void snapshot_record_start(void)
+{
+	recording = 1;
+}
+
+int snapshot_recording(void)
+{
+	return recording;
+}
+
+void snapshot_record_control(libusb_device_handle *hdev, u_int8_t requesttype,
+			     u_int8_t request, u_int16_t value, u_int16_t idx,
+			     u_int16_t size, const unsigned char *data, int status)
+{
+	struct rec_device *rd;
+	struct rec_ctrl *c;
+	size_t len = status > 0 ? (size_t)status : 0;
+
+	if (!recording || !hdev || !(requesttype & LIBUSB_ENDPOINT_IN))
+		return;
+	rd = rec_find(libusb_get_device(hdev), 1);
+	if (!rd)
+		return;
+	/* the first answer is the one the dump used */
+	for (c = rd->ctrl; c; c = c->next)
+		if (c->requesttype == requesttype && c->request == request &&
+		    c->value == value && c->idx == idx && c->length == size)
+			return;
+	c = malloc(sizeof(*c) + len);
+	if (!c)
+		return;
+	c->next = NULL;
+	c->requesttype = requesttype;
+	c->request = request;
+	c->value = value;
+	c->idx = idx;
+	c->length = size;
+	c->status = status;
+	if (len)
+		memcpy(c->data, data, len);
+	*rd->ctrl_tail = c;
+	rd->ctrl_tail = &c->next;
+	rd->nctrl++;
+}
+
+/* ---------------------------------------------------------------------- */
+
+struct outbuf {
+	unsigned char *p;
+	size_t len, alloc;	/* p[0] is the start of the file */
+	int failed;
+};
+
+static void out_append(struct outbuf *b, const void *data, size_t len)
+{
+	unsigned char *p;
+	size_t alloc;
+
+	if (b->failed || !len)
+		return;
+	if (b->len + len > b->alloc) {
+		alloc = b->alloc ? b->alloc : 65536;
+		while (alloc < b->len + len)
+			alloc *= 2;
+		p = realloc(b->p, alloc);
+		if (!p) {
+			b->failed = 1;
+			return;
+		}
+		b->p = p;
+		b->alloc = alloc;
+	}
+	if (data)
+		memcpy(b->p + b->len, data, len);
+	else
+		memset(b->p + b->len, 0, len);
+	b->len += len;
+}
+
+/* file offset for the next item, kept aligned for the loader */
+static u_int32_t out_start(struct outbuf *b)
+{
+	if (b->len & 3)
+		out_append(b, NULL, 4 - (b->len & 3));
+	return b->len;
+}
+
+static u_int32_t out_str(struct outbuf *b, const char *s)
+{
+	u_int32_t off;
+
+	if (!s)
+		return 0;
+	off = out_start(b);
+	out_append(b, s, strlen(s) + 1);
+	return off;
+}
+
+/* the wire format of a parsed configuration, which parses back the same */
+static void out_config(struct outbuf *b, const struct libusb_config_descriptor *config)
+{
+	unsigned char d[LIBUSB_DT_ENDPOINT_AUDIO_SIZE > LIBUSB_DT_CONFIG_SIZE ?
+			LIBUSB_DT_ENDPOINT_AUDIO_SIZE : LIBUSB_DT_CONFIG_SIZE];
+	int i, j, k;
+
+	d[0] = LIBUSB_DT_CONFIG_SIZE;
+	d[1] = LIBUSB_DT_CONFIG;
+	d[2] = config->wTotalLength & 0xff;
+	d[3] = config->wTotalLength >> 8;
+	d[4] = config->bNumInterfaces;
+	d[5] = config->bConfigurationValue;
+	d[6] = config->iConfiguration;
+	d[7] = config->bmAttributes;
+	d[8] = config->MaxPower;
+	out_append(b, d, LIBUSB_DT_CONFIG_SIZE);
+	out_append(b, config->extra, config->extra_length);
+
+	for (i = 0; i < config->bNumInterfaces; i++) {
+		const struct libusb_interface *intf = &config->interface[i];
+
+		for (j = 0; j < intf->num_altsetting; j++) {
+			const struct libusb_interface_descriptor *alt = &intf->altsetting[j];
+
+			d[0] = LIBUSB_DT_INTERFACE_SIZE;
+			d[1] = LIBUSB_DT_INTERFACE;
+			d[2] = alt->bInterfaceNumber;
+			d[3] = alt->bAlternateSetting;
+			d[4] = alt->bNumEndpoints;
+			d[5] = alt->bInterfaceClass;
+			d[6] = alt->bInterfaceSubClass;
+			d[7] = alt->bInterfaceProtocol;
+			d[8] = alt->iInterface;
+			out_append(b, d, LIBUSB_DT_INTERFACE_SIZE);
+			out_append(b, alt->extra, alt->extra_length);
+
+			for (k = 0; k < alt->bNumEndpoints; k++) {
+				const struct libusb_endpoint_descriptor *ep = &alt->endpoint[k];
+
+				d[0] = ep->bLength >= LIBUSB_DT_ENDPOINT_AUDIO_SIZE ?
+					LIBUSB_DT_ENDPOINT_AUDIO_SIZE : LIBUSB_DT_ENDPOINT_SIZE;
+				d[1] = LIBUSB_DT_ENDPOINT;
+				d[2] = ep->bEndpointAddress;
+				d[3] = ep->bmAttributes;
+				d[4] = ep->wMaxPacketSize & 0xff;
+				d[5] = ep->wMaxPacketSize >> 8;
+				d[6] = ep->bInterval;
+				d[7] = ep->bRefresh;
+				d[8] = ep->bSynchAddress;
+				out_append(b, d, d[0]);
+				out_append(b, ep->extra, ep->extra_length);
+			}
+		}
+	}
+}
+
+/*
+ * Configurations go in as the device sent them where the kernel kept a
+ * copy, so bLength, wTotalLength and anything libusb skips survive;
+ * elsewhere they are rebuilt from what libusb parsed.
+ */
+static void out_config_raw(struct outbuf *b, const struct usbdevice *d, int index,
+			   const struct libusb_config_descriptor *config)
+{
+#ifdef OS_LINUX
+	const unsigned char *p;
+	int len;
+
+	if (!sysfs_get_config_raw(sysfs_dev_get(d->location_id), index, &p, &len)) {
+		out_append(b, p, len);
+		return;
+	}
+#endif
+	out_config(b, config);
+}
+
+static void out_device_desc(u_int8_t *d, const struct libusb_device_descriptor *desc)
+{
+	d[0] = desc->bLength;
+	d[1] = desc->bDescriptorType;
+	d[2] = desc->bcdUSB & 0xff;
+	d[3] = desc->bcdUSB >> 8;
+	d[4] = desc->bDeviceClass;
+	d[5] = desc->bDeviceSubClass;
+	d[6] = desc->bDeviceProtocol;
+	d[7] = desc->bMaxPacketSize0;
+	d[8] = desc->idVendor & 0xff;
+	d[9] = desc->idVendor >> 8;
+	d[10] = desc->idProduct & 0xff;
+	d[11] = desc->idProduct >> 8;
+	d[12] = desc->bcdDevice & 0xff;
+	d[13] = desc->bcdDevice >> 8;
+	d[14] = desc->iManufacturer;
+	d[15] = desc->iProduct;
+	d[16] = desc->iSerialNumber;
+	d[17] = desc->bNumConfigurations;
+}
+
+static void out_device(struct outbuf *b, struct snap_device *sd, const struct usbdevice *d)
+{
+	struct libusb_config_descriptor *config;
+	struct snap_config *sc;
+	struct rec_device *rd = rec_find(d->dev, 0);
+	unsigned char ifnums[256];
+	int i, j, n;
+
+	sd->location_id = d->location_id;
+	sd->speed = d->speed;
+	sd->busnum = d->busnum;
+	sd->devnum = d->devnum;
+	n = usbdev_get_port_numbers(d->dev, sd->ports, sizeof(sd->ports));
+	sd->nports = n > 0 ? n : 0;
+	out_device_desc(sd->desc, &d->desc);
+
+	/* every configuration, and which interface numbers there are */
+	memset(ifnums, 0, sizeof(ifnums));
+	sd->nconfigs = d->desc.bNumConfigurations;
+	sc = calloc(sd->nconfigs ? sd->nconfigs : 1, sizeof(*sc));
+	if (!sc) {
+		b->failed = 1;
+		return;
+	}
+	for (i = 0; i < sd->nconfigs; i++) {
+		sc[i].ret = get_config(d->dev, i, &config);
+		if (sc[i].ret)
+			continue;
+		sc[i].data = out_start(b);
+		out_config_raw(b, d, i, config);
+		sc[i].len = b->len - sc[i].data;
+		for (j = 0; j < config->bNumInterfaces; j++)
+			if (config->interface[j].num_altsetting)
+				ifnums[config->interface[j].altsetting[0].bInterfaceNumber] = 1;
+	}
+	sd->configs = out_start(b);
+	out_append(b, sc, sd->nconfigs * sizeof(*sc));
+	free(sc);
+
+#ifdef OS_LINUX
+	{
+		struct sysfs_dev *sys = sysfs_dev_get(d->location_id);
+		struct snap_driver drv[256];
+		char name[MY_PATH_MAX];
+		int attr;
+
+		for (attr = 0; attr < SYSFS_NSAVED && attr < SNAPSHOT_NATTRS; attr++)
+			sd->attr[attr] = out_str(b, sysfs_dev_attr(sys, attr));
+
+		/* names first, then the table pointing at them */
+		for (i = 0, n = 0; i < 256; i++) {
+			if (!ifnums[i] || sysfs_dev_driver(sys, i, name, sizeof(name)) <= 0)
+				continue;
+			drv[n].ifnum = i;
+			drv[n++].name = out_str(b, name);
+		}
+		if (n) {
+			sd->drivers = out_start(b);
+			sd->ndrivers = n;
+			out_append(b, drv, n * sizeof(drv[0]));
+		}
+	}
+#endif
+
+	if (!rd)
+		return;
+	sd->opened = rd->opened;
+	if (rd->nkdrivers) {
+		struct rec_driver *rdrv;
+		struct snap_driver *drv = calloc(rd->nkdrivers, sizeof(*drv));
+
+		if (!drv) {
+			b->failed = 1;
+			return;
+		}
+		for (rdrv = rd->kdrivers, i = 0; rdrv; rdrv = rdrv->next, i++) {
+			drv[i].ifnum = rdrv->ifnum;
+			drv[i].name = out_str(b, rdrv->name);
+		}
+		sd->kdrivers = out_start(b);
+		sd->nkdrivers = rd->nkdrivers;
+		out_append(b, drv, rd->nkdrivers * sizeof(*drv));
+		free(drv);
+	}
+	if (rd->nctrl) {
+		struct rec_ctrl *rc;
+		struct snap_ctrl *c = calloc(rd->nctrl, sizeof(*c));
+
+		if (!c) {
+			b->failed = 1;
+			return;
+		}
+		for (rc = rd->ctrl, i = 0; rc; rc = rc->next, i++) {
+			c[i].requesttype = rc->requesttype;
+			c[i].request = rc->request;
+			c[i].value = rc->value;
+			c[i].idx = rc->idx;
+			c[i].length = rc->length;
+			c[i].status = rc->status;
+			if (rc->status > 0) {
+				c[i].data = out_start(b);
+				out_append(b, rc->data, rc->status);
+			}
+		}
+		sd->ctrl = out_start(b);
+		sd->nctrl = rd->nctrl;
+		out_append(b, c, rd->nctrl * sizeof(*c));
+		free(c);
+	}
+}
+
+/* the whole file, in memory */
+static unsigned char *snap_build(const struct usbmodel *m, size_t *size)
+{
+	struct snap_header h;
+	struct snap_device sd;
+	struct outbuf b;
+	unsigned int i;
+
+	memset(&b, 0, sizeof(b));
+	out_append(&b, NULL, sizeof(h) + m->ndevices * sizeof(sd));
+	for (i = 0; i < m->ndevices; i++) {
+		memset(&sd, 0, sizeof(sd));
+		out_device(&b, &sd, m->devices[i]);
+		if (!b.failed)
+			memcpy(b.p + sizeof(h) + i * sizeof(sd), &sd, sizeof(sd));
+	}
+	out_start(&b);
+	if (b.failed || b.len > 0xffffffffUL) {
+		free(b.p);
+		return NULL;
+	}
+
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic));
+	h.version = SNAPSHOT_VERSION;
+	h.byteorder = SNAPSHOT_BYTEORDER;
+	h.ndevices = m->ndevices;
+	h.size = b.len;
+	memcpy(b.p, &h, sizeof(h));
+	*size = b.len;
+	return b.p;
+}
+
+int snapshot_save(const char *path, const struct usbmodel *m)
+{
+	unsigned char *p;
+	size_t size;
+	FILE *f;
+	int ret = 0;
+
+	p = snap_build(m, &size);
+	rec_free_all();
+	recording = 0;
+	if (!p) {
+		fprintf(stderr, "Couldn't build the snapshot for %s\n", path);
+		return -1;
+	}
+
+	f = fopen(path, "wb");
+	if (f) {
+		if (fwrite(p, size, 1, f) != 1)
+			ret = -1;
+		if (fclose(f))
+			ret = -1;
+	}
+	if (!f || ret) {
+		fprintf(stderr, "Couldn't write %s: %s\n", path, strerror(errno));
+		ret = -1;
+	}
+	free(p);
+	return ret;
+}
+
+/* the devices of the model as they are now, for comparing */
+struct snapshot *snapshot_take(const struct usbmodel *m)
+{
+	unsigned char *p;
+	size_t size;
+
+	p = snap_build(m, &size);
+	if (!p) {
+		fprintf(stderr, "out of memory\n");
+		return NULL;
+	}
+	return snap_init(p, size, 0, "the current state");
+}
+
+/* ---------------------------------------------------------------------- */
+
+ssize_t usbdev_get_device_list(libusb_context *ctx, libusb_device ***list)
+{
+	unsigned int i;
+
+	if (!loaded)
+		return libusb_get_device_list(ctx, list);
+	*list = calloc(loaded->ndevices + 1, sizeof(**list));
+	if (!*list)
+		return LIBUSB_ERROR_NO_MEM;
+	for (i = 0; i < loaded->ndevices; i++)
+		(*list)[i] = (libusb_device *)&loaded->devs[i];
+	return loaded->ndevices;
+}
+
+void usbdev_free_device_list(libusb_device **list, int unref_devices)
+{
+	if (!loaded)
+		libusb_free_device_list(list, unref_devices);
+	else
+		free(list);
+}
+
+libusb_device *usbdev_ref_device(libusb_device *dev)
+{
+	return loaded ? dev : libusb_ref_device(dev);
+}
+
+void usbdev_unref_device(libusb_device *dev)
+{
+	if (!loaded)
+		libusb_unref_device(dev);
+}
+
+int usbdev_get_device_descriptor(libusb_device *dev,
+				 struct libusb_device_descriptor *desc)
+{
+	if (!loaded)
+		return libusb_get_device_descriptor(dev, desc);
+	snap_device_desc(snap_dev(dev), desc);
+	return LIBUSB_SUCCESS;
+}
+
+/*
+ * A device libusb made from its node alone, for lsusb -D, does not know
+ * its bus or ports; the caller found them in sysfs and pins them here.
+ */
+static libusb_device *pinned_dev;
+static u_int8_t pinned_busnum, pinned_devnum, pinned_ports[7];
+static int pinned_nports;
+
+void usbdev_pin(libusb_device *dev, unsigned int busnum, unsigned int devnum,
+		unsigned int location_id)
+{
+	pinned_dev = dev;
+	pinned_busnum = busnum;
+	pinned_devnum = devnum;
+	for (pinned_nports = 0; pinned_nports < 6; pinned_nports++) {
+		pinned_ports[pinned_nports] = (location_id >> (20 - 4 * pinned_nports)) & 0xf;
+		if (!pinned_ports[pinned_nports])
+			break;
+	}
+}
+
+u_int8_t usbdev_get_bus_number(libusb_device *dev)
+{
+	if (loaded)
+		return snap_dev(dev)->busnum;
+	return dev == pinned_dev ? pinned_busnum : libusb_get_bus_number(dev);
+}
+
+u_int8_t usbdev_get_device_address(libusb_device *dev)
+{
+	if (loaded)
+		return snap_dev(dev)->devnum;
+	return dev == pinned_dev ? pinned_devnum : libusb_get_device_address(dev);
+}
+
+int usbdev_get_device_speed(libusb_device *dev)
+{
+	return loaded ? snap_dev(dev)->speed : libusb_get_device_speed(dev);
+}
+
+int usbdev_get_port_numbers(libusb_device *dev, u_int8_t *ports, int len)
+{
+	const struct snap_device *sd;
+
+	if (!loaded && dev == pinned_dev) {
+		if (pinned_nports > len)
+			return LIBUSB_ERROR_OVERFLOW;
+		memcpy(ports, pinned_ports, pinned_nports);
+		return pinned_nports;
+	}
+	if (!loaded)
+		return libusb_get_port_numbers(dev, ports, len);
+	sd = snap_dev(dev);
+	if (sd->nports > len)
+		return LIBUSB_ERROR_OVERFLOW;
+	memcpy(ports, sd->ports, sd->nports);
+	return sd->nports;
+}
+
+static void rec_opened(libusb_device *dev)
+{
+	struct rec_device *rd;
+
+	if (recording && (rd = rec_find(dev, 1)))
+		rd->opened = 1;
+}
+
+int usbdev_open(libusb_device *dev, libusb_device_handle **hdev)
+{
+	int ret;
+
+	if (loaded) {
+		if (!snap_dev(dev)->opened)
+			return LIBUSB_ERROR_ACCESS;
+		*hdev = (libusb_device_handle *)dev;
+		return LIBUSB_SUCCESS;
+	}
+	ret = libusb_open(dev, hdev);
+	if (!ret)
+		rec_opened(dev);
+	return ret;
+}
+
+int usbdev_open_extended(libusb_device *dev, libusb_device_handle **hdev,
+			 struct libusb_options *options,
+			 struct libusb_os_options *os_options)
+{
+	int ret;
+
+	if (loaded)
+		return usbdev_open(dev, hdev);
+	ret = libusb_open_extended(dev, hdev, options, os_options);
+	if (!ret)
+		rec_opened(dev);
+	return ret;
+}
+
+void usbdev_close(libusb_device_handle *hdev)
+{
+	if (!loaded)
+		libusb_close(hdev);
+}
+
+libusb_device *usbdev_get_device(libusb_device_handle *hdev)
+{
+	return loaded ? (libusb_device *)hdev : libusb_get_device(hdev);
+}
+
+int usbdev_get_kernel_driver_name(libusb_device *dev, int ifnum,
+				  unsigned char *buf, int len)
+{
+	const struct snap_device *sd;
+	struct rec_device *rd;
+	struct rec_driver *drv, **pp;
+	size_t n;
+	int ret;
+
+	if (loaded) {
+		sd = snap_dev(dev);
+		ret = snap_driver(loaded, sd->kdrivers, sd->nkdrivers, ifnum, (char *)buf, len);
+		return ret < 0 ? LIBUSB_ERROR_NOT_FOUND : LIBUSB_SUCCESS;
+	}
+	ret = libusb_get_kernel_driver_name(dev, ifnum, buf, len);
+	if (ret || !recording || !(rd = rec_find(dev, 1)))
+		return ret;
+	for (pp = &rd->kdrivers; *pp; pp = &(*pp)->next)
+		if ((*pp)->ifnum == ifnum)
+			return ret;
+	n = strnlen((char *)buf, len);
+	drv = malloc(sizeof(*drv) + n + 1);
+	if (!drv)
+		return ret;
+	drv->next = NULL;
+	drv->ifnum = ifnum;
+	memcpy(drv->name, buf, n);
+	drv->name[n] = '\0';
+	*pp = drv;
+	rd->nkdrivers++;
+	return ret;
+}
+
+/* nothing to claim in a recording, and its answers need no claim */
+int usbdev_claim_interface(libusb_device_handle *hdev, int ifnum)
+{
+	return loaded ? LIBUSB_SUCCESS : libusb_claim_interface(hdev, ifnum);
+}
+
+int usbdev_release_interface(libusb_device_handle *hdev, int ifnum)
+{
+	return loaded ? LIBUSB_SUCCESS : libusb_release_interface(hdev, ifnum);
+}
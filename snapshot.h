@@ -0,0 +1,107 @@
+/*****************************************************************************/
+
+/*
+ *      snapshot.h  --  saved device state, and device access that can use it
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifndef _SNAPSHOT_H
+#define _SNAPSHOT_H
+
+#include <sys/types.h>
+#include <libusb.h>
+
+struct usbmodel;
+
+/*
+ * The usbdev_*() calls behave like the libusb calls of the same name.
+ * While recording they also remember the answers; once a snapshot is
+ * loaded they answer from it instead and never touch the bus.
+ */
+
+extern ssize_t usbdev_get_device_list(libusb_context *ctx, libusb_device ***list);
+extern void usbdev_free_device_list(libusb_device **list, int unref_devices);
+extern libusb_device *usbdev_ref_device(libusb_device *dev);
+extern void usbdev_unref_device(libusb_device *dev);
+extern int usbdev_get_device_descriptor(libusb_device *dev,
+					struct libusb_device_descriptor *desc);
+extern u_int8_t usbdev_get_bus_number(libusb_device *dev);
+extern u_int8_t usbdev_get_device_address(libusb_device *dev);
+extern int usbdev_get_device_speed(libusb_device *dev);
+extern int usbdev_get_port_numbers(libusb_device *dev, u_int8_t *ports, int len);
+extern int usbdev_open(libusb_device *dev, libusb_device_handle **hdev);
+extern int usbdev_open_extended(libusb_device *dev, libusb_device_handle **hdev,
+				struct libusb_options *options,
+				struct libusb_os_options *os_options);
+extern void usbdev_close(libusb_device_handle *hdev);
+extern libusb_device *usbdev_get_device(libusb_device_handle *hdev);
+extern int usbdev_get_kernel_driver_name(libusb_device *dev, int ifnum,
+					 unsigned char *buf, int len);
+extern int usbdev_claim_interface(libusb_device_handle *hdev, int ifnum);
+extern int usbdev_release_interface(libusb_device_handle *hdev, int ifnum);
+extern void usbdev_pin(libusb_device *dev, unsigned int busnum, unsigned int devnum,
+		       unsigned int location_id);
+
+/* ---------------------------------------------------------------------- */
+
+/* a recorded device, as lsusb --diff compares them */
+struct snapshot_device {
+	unsigned int location_id;
+	unsigned int busnum, devnum;
+	int speed;
+	u_int8_t ports[8];
+	unsigned int nports;
+	struct libusb_device_descriptor desc;
+	unsigned int nconfigs;
+	const char *serial;		/* NULL if sysfs had none */
+};
+
+struct snapshot;
+
+extern struct snapshot *snapshot_open(const char *path);
+extern struct snapshot *snapshot_take(const struct usbmodel *m);
+extern void snapshot_close(struct snapshot *s);
+extern unsigned int snapshot_ndevices(const struct snapshot *s);
+extern void snapshot_device(const struct snapshot *s, unsigned int i,
+			    struct snapshot_device *d);
+extern int snapshot_config(const struct snapshot *s, unsigned int i, int index,
+			   const unsigned char **data, unsigned int *len);
+extern const char *snapshot_driver(const struct snapshot *s, unsigned int i,
+				   unsigned int k, int *ifnum);
+
+/* the one lsusb --load shows */
+extern int snapshot_load(const char *path);
+extern void snapshot_unload(void);
+extern int snapshot_loaded(void);
+extern void snapshot_record_start(void);
+extern int snapshot_recording(void);
+extern int snapshot_save(const char *path, const struct usbmodel *m);
+
+/* for usbxfer.c and usbmisc.c */
+extern int snapshot_control(libusb_device_handle *hdev, u_int8_t requesttype,
+			    u_int8_t request, u_int16_t value, u_int16_t idx,
+			    unsigned char *data, u_int16_t size);
+extern void snapshot_record_control(libusb_device_handle *hdev, u_int8_t requesttype,
+				    u_int8_t request, u_int16_t value, u_int16_t idx,
+				    u_int16_t size, const unsigned char *data, int status);
+extern int snapshot_get_config(libusb_device *dev, int index,
+			       struct libusb_config_descriptor **config);
+extern const char *snapshot_sysfs_attr(unsigned int location_id, int attr);
+extern int snapshot_sysfs_driver(unsigned int location_id, int ifnum,
+				 char *buf, size_t size);
+
+/* ---------------------------------------------------------------------- */
+#endif /* _SNAPSHOT_H */
@@ -0,0 +1,360 @@
+/*****************************************************************************/
+
+/*
+ *      timing.c  --  where the time of an lsusb run goes
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "timing.h"
+#include "usbxfer.h"
+
+/*
+ * lsusb --timing keeps one small record per timed phase: when it started
+ * and how long it took on CLOCK_MONOTONIC, what it was and for which
+ * device.  Recording is two clock reads and an append, so it is cheap
+ * enough to leave on.  All the sorting and adding up for the summary is
+ * done once, at the end of the run, when the trace is written as well.
+ */
+
+#define TIMING_TOP_DEVICES	10
+
+struct timing_event {
+	u_int64_t start, duration;
+	const char *what;		/* static, or NULL */
+	unsigned int detail;
+	unsigned int location_id;	/* 0 if not about one device */
+	enum timing_phase phase;
+};
+
+struct timing_group {
+	enum timing_phase phase;
+	const char *what;
+	unsigned int detail;
+	unsigned long count;
+	u_int64_t total, max;
+};
+
+struct timing_device {
+	unsigned int location_id;
+	u_int64_t total[TIMING_NPHASES];
+	u_int64_t worst;
+};
+
+int timing_enabled;
+
+static struct timing_event *events;
+static size_t nevents, events_size;
+static unsigned long dropped;
+static u_int64_t epoch;
+static FILE *trace;
+
+static const char *const phase_names[TIMING_NPHASES] = {
+	[TIMING_ENUMERATE] = "enumerate",
+	[TIMING_OPEN] = "open",
+	[TIMING_CONTROL] = "control",
+	[TIMING_STRING] = "string",
+	[TIMING_SYSFS] = "sysfs",
+	[TIMING_NAMES] = "names",
+	[TIMING_RENDER] = "render",
+};
+
+/* ---------------------------------------------------------------------- */
+
+u_int64_t timing_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u_int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void timing_record(enum timing_phase phase, const char *what, unsigned int detail,
+		   unsigned int location_id, u_int64_t start)
+{
+	u_int64_t end;
+	struct timing_event *e;
+
+	/* off unless --timing: no clock read */
+	if (!start)
+		return;
+	end = timing_now();
+	if (nevents == events_size) {
+		size_t size = events_size ? 2 * events_size : 1024;
+
+		e = realloc(events, size * sizeof(*e));
+		if (!e) {
+			dropped++;
+			return;
+		}
+		events = e;
+		events_size = size;
+	}
+	e = &events[nevents++];
+	e->start = start;
+	e->duration = end - start;
+	e->what = what;
+	e->detail = detail;
+	e->location_id = location_id;
+	e->phase = phase;
+}
+
+/* from here on, with the trace written to tracefile if not NULL */
+int timing_begin(const char *tracefile)
+{
+	if (tracefile) {
+		trace = fopen(tracefile, "w");
+		if (!trace) {
+			fprintf(stderr, "Couldn't open %s: %s\n", tracefile, strerror(errno));
+			return -1;
+		}
+	}
+	epoch = timing_now();
+	timing_enabled = 1;
+	return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+static void event_label(const struct timing_event *e, char *buf, size_t size)
+{
+	if (e->phase == TIMING_CONTROL)
+		xfer_kind_name(e->detail, buf, size);
+	else if (e->phase == TIMING_STRING)
+		snprintf(buf, size, "index %u", e->detail);
+	else
+		snprintf(buf, size, "%s", e->what ? e->what : "");
+}
+
+/* like 1-2.3, as in sysfs */
+const char *timing_location_name(unsigned int location_id, char *buf, size_t size)
+{
+	unsigned int i, port;
+	size_t len;
+
+	if (!location_id)
+		return "-";
+	if (!(location_id & 0x00ffffff)) {
+		snprintf(buf, size, "usb%u", location_id >> 24);
+		return buf;
+	}
+	len = snprintf(buf, size, "%u", location_id >> 24);
+	for (i = 0; i < 6 && len < size; i++) {
+		port = (location_id >> (20 - 4 * i)) & 0xf;
+		if (!port)
+			break;
+		len += snprintf(buf + len, size - len, "%c%u", i ? '.' : '-', port);
+	}
+	return buf;
+}
+
+static int cmp_strings(const char *a, const char *b)
+{
+	if (a == b)
+		return 0;
+	if (!a || !b)
+		return a ? 1 : -1;
+	return strcmp(a, b);
+}
+
+/* control requests are summed per kind, everything else per what */
+static unsigned int group_detail(const struct timing_event *e)
+{
+	return e->phase == TIMING_CONTROL ? e->detail : 0;
+}
+
+static int cmp_events_by_kind(const void *a, const void *b)
+{
+	const struct timing_event *ea = *(const struct timing_event * const *)a;
+	const struct timing_event *eb = *(const struct timing_event * const *)b;
+	int r;
+
+	if (ea->phase != eb->phase)
+		return ea->phase < eb->phase ? -1 : 1;
+	r = cmp_strings(ea->what, eb->what);
+	if (r)
+		return r;
+	return group_detail(ea) < group_detail(eb) ? -1 : group_detail(ea) > group_detail(eb);
+}
+
+static int cmp_groups(const void *a, const void *b)
+{
+	const struct timing_group *ga = a, *gb = b;
+
+	if (ga->phase != gb->phase)
+		return ga->phase < gb->phase ? -1 : 1;
+	return ga->total > gb->total ? -1 : ga->total < gb->total;
+}
+
+static int cmp_events_by_device(const void *a, const void *b)
+{
+	unsigned int la = (*(const struct timing_event * const *)a)->location_id;
+	unsigned int lb = (*(const struct timing_event * const *)b)->location_id;
+
+	return la < lb ? -1 : la > lb;
+}
+
+static int cmp_devices(const void *a, const void *b)
+{
+	const struct timing_device *da = a, *db = b;
+
+	return da->worst > db->worst ? -1 : da->worst < db->worst;
+}
+
+static void print_phases(struct timing_event **sorted)
+{
+	struct timing_group *groups;
+	unsigned int ngroups = 0;
+	char label[64];
+	size_t i;
+
+	groups = calloc(nevents, sizeof(*groups));
+	if (!groups)
+		return;
+	qsort(sorted, nevents, sizeof(*sorted), cmp_events_by_kind);
+	for (i = 0; i < nevents; i++) {
+		struct timing_group *g;
+
+		if (!i || cmp_events_by_kind(&sorted[i - 1], &sorted[i])) {
+			g = &groups[ngroups++];
+			g->phase = sorted[i]->phase;
+			g->what = sorted[i]->what;
+			g->detail = group_detail(sorted[i]);
+		}
+		g = &groups[ngroups - 1];
+		g->count++;
+		g->total += sorted[i]->duration;
+		if (sorted[i]->duration > g->max)
+			g->max = sorted[i]->duration;
+	}
+	qsort(groups, ngroups, sizeof(*groups), cmp_groups);
+
+	fprintf(stderr, "%-10s %8s %12s %10s  %s\n", "phase", "count", "total ms", "max ms", "what");
+	for (i = 0; i < ngroups; i++) {
+		struct timing_event e = {
+			.phase = groups[i].phase,
+			.what = groups[i].what,
+			.detail = groups[i].detail,
+		};
+
+		if (e.phase == TIMING_STRING)
+			label[0] = 0;
+		else
+			event_label(&e, label, sizeof(label));
+		fprintf(stderr, "%-10s %8lu %12.3f %10.3f%s%s\n", phase_names[e.phase],
+			groups[i].count, groups[i].total / 1e6, groups[i].max / 1e6,
+			label[0] ? "  " : "", label);
+	}
+	free(groups);
+}
+
+static void print_devices(struct timing_event **sorted)
+{
+	struct timing_device *devs;
+	unsigned int ndevs = 0, p;
+	char name[32];
+	size_t i;
+
+	devs = calloc(nevents, sizeof(*devs));
+	if (!devs)
+		return;
+	qsort(sorted, nevents, sizeof(*sorted), cmp_events_by_device);
+	for (i = 0; i < nevents; i++) {
+		struct timing_device *d;
+
+		if (!sorted[i]->location_id)
+			continue;
+		if (!ndevs || devs[ndevs - 1].location_id != sorted[i]->location_id)
+			devs[ndevs++].location_id = sorted[i]->location_id;
+		d = &devs[ndevs - 1];
+		d->total[sorted[i]->phase] += sorted[i]->duration;
+		if (d->total[sorted[i]->phase] > d->worst)
+			d->worst = d->total[sorted[i]->phase];
+	}
+	if (!ndevs) {
+		free(devs);
+		return;
+	}
+	qsort(devs, ndevs, sizeof(*devs), cmp_devices);
+
+	fprintf(stderr, "\n%-16s", "slowest devices");
+	for (p = TIMING_OPEN; p < TIMING_NPHASES; p++)
+		fprintf(stderr, " %10s", phase_names[p]);
+	fprintf(stderr, "  (ms)\n");
+	for (i = 0; i < ndevs && i < TIMING_TOP_DEVICES; i++) {
+		fprintf(stderr, "%-16s", timing_location_name(devs[i].location_id, name, sizeof(name)));
+		for (p = TIMING_OPEN; p < TIMING_NPHASES; p++)
+			fprintf(stderr, " %10.3f", devs[i].total[p] / 1e6);
+		fprintf(stderr, "\n");
+	}
+	free(devs);
+}
+
+static void write_trace(void)
+{
+	char label[64], name[32];
+	size_t i;
+
+	fprintf(trace, "# start_ns\tduration_ns\tphase\tdevice\twhat\n");
+	for (i = 0; i < nevents; i++) {
+		event_label(&events[i], label, sizeof(label));
+		fprintf(trace, "%llu\t%llu\t%s\t%s\t%s\n",
+			(unsigned long long)(events[i].start - epoch),
+			(unsigned long long)events[i].duration,
+			phase_names[events[i].phase],
+			timing_location_name(events[i].location_id, name, sizeof(name)), label);
+	}
+	if (fclose(trace))
+		fprintf(stderr, "Couldn't write the timing trace: %s\n", strerror(errno));
+	trace = NULL;
+}
+
+/* the summary goes to stderr, so it does not mix with the output */
+void timing_end(void)
+{
+	struct timing_event **sorted;
+	size_t i;
+
+	if (!timing_enabled)
+		return;
+	timing_enabled = 0;
+
+	fprintf(stderr, "\nlsusb: %.3f ms in all\n", (timing_now() - epoch) / 1e6);
+	sorted = calloc(nevents ? nevents : 1, sizeof(*sorted));
+	if (sorted) {
+		for (i = 0; i < nevents; i++)
+			sorted[i] = &events[i];
+		print_phases(sorted);
+		print_devices(sorted);
+		free(sorted);
+	}
+	if (dropped)
+		fprintf(stderr, "out of memory, %lu timings lost\n", dropped);
+	if (trace)
+		write_trace();
+	free(events);
+	events = NULL;
+	nevents = events_size = 0;
+}
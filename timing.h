@@ -0,0 +1,62 @@
+/*****************************************************************************/
+
+/*
+ *      timing.h  --  where the time of an lsusb run goes
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifndef _TIMING_H
+#define _TIMING_H
+
+#include <sys/types.h>
+
+/*
+ * A phase is timed by taking timing_start() before it and passing that
+ * to timing_record() after it.  Unless --timing was given, timing_start()
+ * is 0 and timing_record() ignores it; call sites only check it to skip
+ * working out which device it was.  Phases nest: a string fetch includes
+ * its control requests, rendering a device everything done meanwhile.
+ */
+
+enum timing_phase {
+	TIMING_ENUMERATE,
+	TIMING_OPEN,
+	TIMING_CONTROL,		/* detail is XFER_KIND() */
+	TIMING_STRING,		/* detail is the string index */
+	TIMING_SYSFS,
+	TIMING_NAMES,
+	TIMING_RENDER,
+	TIMING_NPHASES
+};
+
+extern int timing_enabled;
+
+extern u_int64_t timing_now(void);
+extern void timing_record(enum timing_phase phase, const char *what,
+			  unsigned int detail, unsigned int location_id,
+			  u_int64_t start);
+extern const char *timing_location_name(unsigned int location_id, char *buf,
+					size_t size);
+extern int timing_begin(const char *tracefile);
+extern void timing_end(void);
+
+static inline u_int64_t timing_start(void)
+{
+	return timing_enabled ? timing_now() : 0;
+}
+
+/* ---------------------------------------------------------------------- */
+#endif /* _TIMING_H */
@@ -0,0 +1,342 @@
+/*****************************************************************************/
+
+/*
+ *      usbids-compile.c  --  build the compiled usb.ids index
+ *
+ *      Reads usb.ids and writes the index described in usbids.h, which
+ *      lsusb maps at startup instead of parsing anything.
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "phash.h"
+#include "usbids.h"
+
+struct section {
+	struct usbids_entry *entries;
+	unsigned int n, alloc;
+};
+
+static struct section sections[USBIDS_NSECTIONS];
+static char *pool;
+static size_t pool_len, pool_alloc;
+
+static int add_entry(enum usbids_section_id id, unsigned int key, const char *name)
+{
+	struct section *s = &sections[id];
+	size_t len = strlen(name) + 1;
+
+	if (s->n == s->alloc) {
+		unsigned int alloc = s->alloc ? 2 * s->alloc : 256;
+		struct usbids_entry *e = realloc(s->entries, alloc * sizeof(*e));
+
+		if (!e)
+			return -1;
+		s->entries = e;
+		s->alloc = alloc;
+	}
+	if (pool_len + len > pool_alloc) {
+		size_t alloc = pool_alloc ? 2 * pool_alloc : 65536;
+		char *p;
+
+		while (alloc < pool_len + len)
+			alloc *= 2;
+		p = realloc(pool, alloc);
+		if (!p)
+			return -1;
+		pool = p;
+		pool_alloc = alloc;
+	}
+	s->entries[s->n].key = key;
+	s->entries[s->n].name = pool_len;	/* relocated when written */
+	s->n++;
+	memcpy(pool + pool_len, name, len);
+	pool_len += len;
+	return 0;
+}
+
+/* "<hex id>  <name>"; returns the name or NULL if the line is malformed */
+static char *parse_id(char *p, unsigned int *id)
+{
+	char *end;
+
+	*id = strtoul(p, &end, 16);
+	if (end == p || !isspace((unsigned char)*end))
+		return NULL;
+	while (isspace((unsigned char)*end))
+		end++;
+	return *end ? end : NULL;
+}
+
+enum context {
+	CTX_NONE, CTX_VENDOR, CTX_CLASS, CTX_HUT, CTX_LANG
+};
+
+static int parse(FILE *f, char *source, size_t source_size)
+{
+	char line[1024];
+	enum context ctx = CTX_NONE;
+	unsigned int parent = 0, parent2 = 0;
+	unsigned int lineno = 0, id;
+	char *name;
+	int r = 0;
+
+	while (fgets(line, sizeof(line), f)) {
+		size_t len = strlen(line);
+
+		lineno++;
+		while (len && isspace((unsigned char)line[len - 1]))
+			line[--len] = 0;
+		if (!strncmp(line, "# Version:", 10)) {
+			snprintf(source, source_size, "%s", line + 10 + strspn(line + 10, " \t"));
+			continue;
+		}
+		if (!len || line[0] == '#')
+			continue;
+
+		if (line[0] == '\t' && line[1] == '\t') {
+			/* interfaces below products are not used */
+			if (ctx != CTX_CLASS)
+				continue;
+			name = parse_id(line + 2, &id);
+			if (name)
+				r = add_entry(USBIDS_PROTOCOL, (parent << 16) + (parent2 << 8) + id, name);
+		} else if (line[0] == '\t') {
+			name = parse_id(line + 1, &id);
+			if (!name)
+				goto bad;
+			switch (ctx) {
+			case CTX_VENDOR:
+				r = add_entry(USBIDS_PRODUCT, (parent << 16) + id, name);
+				break;
+			case CTX_CLASS:
+				parent2 = id;
+				r = add_entry(USBIDS_SUBCLASS, (parent << 8) + id, name);
+				break;
+			case CTX_HUT:
+				r = add_entry(USBIDS_HUTUS, (parent << 16) + id, name);
+				break;
+			case CTX_LANG:
+				r = add_entry(USBIDS_LANGID, parent + (id << 10), name);
+				break;
+			default:
+				break;
+			}
+		} else {
+			static const struct {
+				const char *tag;
+				enum usbids_section_id section;
+				enum context ctx;
+			} tags[] = {
+				{ "C ", USBIDS_CLASS, CTX_CLASS },
+				{ "AT ", USBIDS_AUDIOTERMINAL, CTX_NONE },
+				{ "VT ", USBIDS_VIDEOTERMINAL, CTX_NONE },
+				{ "HID ", USBIDS_HID, CTX_NONE },
+				{ "R ", USBIDS_REPORT, CTX_NONE },
+				{ "PHY ", USBIDS_PHYSDES, CTX_NONE },
+				{ "BIAS ", USBIDS_BIAS, CTX_NONE },
+				{ "HUT ", USBIDS_HUT, CTX_HUT },
+				{ "L ", USBIDS_LANGID, CTX_LANG },
+				{ "HCC ", USBIDS_COUNTRYCODE, CTX_NONE },
+			};
+			unsigned int i;
+
+			for (i = 0; i < sizeof(tags) / sizeof(tags[0]); i++)
+				if (!strncmp(line, tags[i].tag, strlen(tags[i].tag)))
+					break;
+			if (i == sizeof(tags) / sizeof(tags[0])) {
+				/* vendors are the only untagged list */
+				if (strspn(line, "0123456789abcdefABCDEF") != 4) {
+					/* unknown list, skip it and its children */
+					ctx = CTX_NONE;
+					continue;
+				}
+				name = parse_id(line, &id);
+				if (!name)
+					goto bad;
+				ctx = CTX_VENDOR;
+				parent = id;
+				r = add_entry(USBIDS_VENDOR, id, name);
+				if (r < 0)
+					break;
+				continue;
+			}
+			name = parse_id(line + strlen(tags[i].tag), &id);
+			if (!name)
+				goto bad;
+			ctx = tags[i].ctx;
+			parent = id;
+			r = add_entry(tags[i].section, id, name);
+		}
+		if (r < 0)
+			break;
+		continue;
+bad:
+		fprintf(stderr, "usbids-compile: line %u: cannot parse \"%s\"\n",
+			lineno, line);
+	}
+	if (r < 0)
+		fprintf(stderr, "usbids-compile: out of memory\n");
+	return r;
+}
+
+static size_t align4(size_t n)
+{
+	return (n + 3) & ~(size_t)3;
+}
+
+static int write_index(FILE *f, const char *source)
+{
+	struct usbids_header hdr;
+	struct phash_table ph[USBIDS_NSECTIONS];
+	size_t off, pool_off;
+	unsigned int i, j;
+	int r = -1;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memset(ph, 0, sizeof(ph));
+	hdr.magic = USBIDS_MAGIC;
+	hdr.version = USBIDS_VERSION;
+	hdr.nsections = USBIDS_NSECTIONS;
+	snprintf(hdr.source, sizeof(hdr.source), "%s", source);
+
+	/* lay out entries, displacements and slots for every section */
+	off = align4(sizeof(hdr));
+	for (i = 0; i < USBIDS_NSECTIONS; i++) {
+		struct section *s = &sections[i];
+		unsigned int *keys = malloc((s->n ? s->n : 1) * sizeof(*keys));
+
+		if (!keys)
+			goto out;
+		for (j = 0; j < s->n; j++)
+			keys[j] = s->entries[j].key;
+		j = phash_build(&ph[i], keys, s->n);
+		free(keys);
+		if (j) {
+			fprintf(stderr, "usbids-compile: cannot index section %u\n", i);
+			goto out;
+		}
+		hdr.section[i].nentries = s->n;
+		hdr.section[i].entries = off;
+		off += s->n * sizeof(struct usbids_entry);
+		hdr.section[i].nbuckets = ph[i].nbuckets;
+		hdr.section[i].disp = off;
+		off = align4(off + ph[i].nbuckets * sizeof(u_int16_t));
+		hdr.section[i].nslots = ph[i].nslots;
+		hdr.section[i].slot = off;
+		off += ph[i].nslots * sizeof(u_int32_t);
+	}
+	pool_off = off;
+	hdr.size = pool_off + pool_len + 1;
+
+	if (fwrite(&hdr, sizeof(hdr), 1, f) != 1)
+		goto out;
+	for (off = sizeof(hdr); off < align4(sizeof(hdr)); off++)
+		fputc(0, f);
+	for (i = 0; i < USBIDS_NSECTIONS; i++) {
+		struct section *s = &sections[i];
+		size_t disp_len = ph[i].nbuckets * sizeof(u_int16_t);
+
+		for (j = 0; j < s->n; j++)
+			s->entries[j].name += pool_off;
+		if (fwrite(s->entries, sizeof(*s->entries), s->n, f) != s->n ||
+		    fwrite(ph[i].disp, sizeof(u_int16_t), ph[i].nbuckets, f) != ph[i].nbuckets)
+			goto out;
+		for (off = disp_len; off < align4(disp_len); off++)
+			fputc(0, f);
+		if (fwrite(ph[i].slot, sizeof(u_int32_t), ph[i].nslots, f) != ph[i].nslots)
+			goto out;
+	}
+	if (fwrite(pool, 1, pool_len, f) != pool_len)
+		goto out;
+	fputc(0, f);
+	r = 0;
+out:
+	for (i = 0; i < USBIDS_NSECTIONS; i++)
+		phash_free(&ph[i]);
+	return r;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *in = USBIDS_FILE, *out = USBIDS_INDEX_FILE;
+	char source[64] = "";
+	char tmp[4096];
+	FILE *f;
+	int quiet = 0;
+	int r;
+
+	if (argc > 1 && !strcmp(argv[1], "-q")) {
+		quiet = 1;
+		argc--;
+		argv++;
+	}
+	if (argc > 3 || (argc > 1 && argv[1][0] == '-')) {
+		fprintf(stderr, "Usage: usbids-compile [-q] [usb.ids [index]]\n"
+			"Compile usb.ids into the index lsusb uses for names\n"
+			"(default %s into %s)\n", in, out);
+		return EXIT_FAILURE;
+	}
+	if (argc > 1)
+		in = argv[1];
+	if (argc > 2)
+		out = argv[2];
+
+	f = fopen(in, "r");
+	if (!f) {
+		fprintf(stderr, "usbids-compile: %s: %s\n", in, strerror(errno));
+		return EXIT_FAILURE;
+	}
+	r = parse(f, source, sizeof(source));
+	fclose(f);
+	if (r < 0)
+		return EXIT_FAILURE;
+	if (!sections[USBIDS_CLASS].n) {
+		fprintf(stderr, "usbids-compile: %s: missing class info, "
+			"probably truncated file\n", in);
+		return EXIT_FAILURE;
+	}
+
+	/* write beside the target and rename, so readers never see half a file */
+	snprintf(tmp, sizeof(tmp), "%s.new", out);
+	f = fopen(tmp, "wb");
+	if (!f) {
+		fprintf(stderr, "usbids-compile: %s: %s\n", tmp, strerror(errno));
+		return EXIT_FAILURE;
+	}
+	r = write_index(f, source);
+	if (fclose(f) != 0)
+		r = -1;
+	if (r < 0 || rename(tmp, out) < 0) {
+		fprintf(stderr, "usbids-compile: cannot write %s: %s\n", out, strerror(errno));
+		unlink(tmp);
+		return EXIT_FAILURE;
+	}
+	if (!quiet)
+		printf("%s: %u vendors, %u products\n", out,
+		       sections[USBIDS_VENDOR].n, sections[USBIDS_PRODUCT].n);
+	return EXIT_SUCCESS;
+}
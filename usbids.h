@@ -0,0 +1,87 @@
+/*****************************************************************************/
+
+/*
+ *      usbids.h  --  layout of the compiled usb.ids index
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifndef _USBIDS_H
+#define _USBIDS_H
+
+#include <sys/types.h>
+
+/*
+ * usbids-compile turns usb.ids into a file that lsusb maps read-only and
+ * queries in place.  All integers are in host byte order; an index built
+ * on a machine of the other endianness fails the magic check and is
+ * ignored.  Offsets are from the start of the file.
+ *
+ * Each section is a set of (key, name) entries with a perfect hash index
+ * over the keys (see phash.h), so a lookup touches the displacement table,
+ * one slot, one entry and the string itself.  Keys use the same encoding
+ * as the built-in tables in usb-spec.h.
+ */
+
+#define USBIDS_MAGIC	0x55534249	/* "USBI" */
+#define USBIDS_VERSION	1
+
+#define USBIDS_FILE		DATADIR "/usb.ids"
+#define USBIDS_INDEX_FILE	DATADIR "/usb.ids.bin"
+
+enum usbids_section_id {
+	USBIDS_VENDOR,		/* vendor */
+	USBIDS_PRODUCT,		/* (vendor << 16) + product */
+	USBIDS_CLASS,		/* class */
+	USBIDS_SUBCLASS,	/* (class << 8) + subclass */
+	USBIDS_PROTOCOL,	/* (class << 16) + (subclass << 8) + protocol */
+	USBIDS_AUDIOTERMINAL,	/* terminal type */
+	USBIDS_VIDEOTERMINAL,	/* terminal type */
+	USBIDS_HID,		/* descriptor type */
+	USBIDS_REPORT,		/* item tag */
+	USBIDS_PHYSDES,		/* physical descriptor item */
+	USBIDS_BIAS,		/* physical descriptor bias */
+	USBIDS_HUT,		/* usage page */
+	USBIDS_HUTUS,		/* (page << 16) + usage */
+	USBIDS_LANGID,		/* primary + (dialect << 10) */
+	USBIDS_COUNTRYCODE,	/* HID country code */
+	USBIDS_NSECTIONS
+};
+
+struct usbids_section {
+	u_int32_t nentries;
+	u_int32_t entries;	/* struct usbids_entry[nentries] */
+	u_int32_t nbuckets;
+	u_int32_t disp;		/* u_int16_t[nbuckets] */
+	u_int32_t nslots;
+	u_int32_t slot;		/* u_int32_t[nslots], entry index + 1 or 0 */
+};
+
+struct usbids_entry {
+	u_int32_t key;
+	u_int32_t name;		/* NUL terminated string */
+};
+
+struct usbids_header {
+	u_int32_t magic;
+	u_int32_t version;
+	u_int32_t size;		/* of the whole file, which ends in a NUL */
+	u_int32_t nsections;
+	char source[64];	/* "# Version:" line of the usb.ids it came from */
+	struct usbids_section section[USBIDS_NSECTIONS];
+};
+
+/* ---------------------------------------------------------------------- */
+#endif /* _USBIDS_H */
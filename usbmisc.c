@@ -26,9 +26,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <limits.h>
 #include <fcntl.h>
+#include <sys/stat.h>
+#ifdef OS_LINUX
+#include <sys/sysmacros.h>
+#endif
 
 #ifdef HAVE_ICONV
 #include <iconv.h>
@@ -39,121 +44,152 @@
 #endif
 
 #include "usbmisc.h"
+#include "usbxfer.h"
+#include "snapshot.h"
+#include "timing.h"
 
 #ifdef OS_LINUX
 /* ---------------------------------------------------------------------- */
 
-static const char *devbususb = "/dev/bus/usb";
+/* under a directory standing in for "/" with sysfs_set_root() */
+static char devbususb[MY_PATH_MAX] = "/dev/bus/usb";
+static char sysfs_usb_devices[MY_PATH_MAX] = SBUD;
+static char sysfs_dev_char[MY_PATH_MAX] = "/sys/dev/char/";
 
 /* ---------------------------------------------------------------------- */
 
-static int readlink_recursive(const char *path, char *buf, size_t bufsize)
+/* for tests and benchmarks on a made up or copied tree, e.g. "/tmp/root" */
+int sysfs_set_root(const char *root)
 {
-	char temp[PATH_MAX + 1];
-	char *ptemp;
-	int ret;
-
-	ret = readlink(path, buf, bufsize-1);
-
-	if (ret > 0) {
-		buf[ret] = 0;
-		if (*buf != '/') {
-			strncpy(temp, path, sizeof(temp));
-			ptemp = temp + strlen(temp);
-			while (*ptemp != '/' && ptemp != temp)
-				ptemp--;
-			ptemp++;
-			strncpy(ptemp, buf, bufsize + temp - ptemp);
-		} else
-			strncpy(temp, buf, sizeof(temp));
-		return readlink_recursive(temp, buf, bufsize);
-	} else {
-		strncpy(buf, path, bufsize);
-		return strlen(buf);
+	size_t len = strlen(root);
+
+	while (len > 1 && root[len - 1] == '/')
+		len--;
+	if (len == 1 && *root == '/')
+		len = 0;
+	if ((size_t)snprintf(sysfs_usb_devices, sizeof(sysfs_usb_devices), "%.*s%s",
+			     (int)len, root, SBUD) >= sizeof(sysfs_usb_devices) ||
+	    (size_t)snprintf(devbususb, sizeof(devbususb), "%.*s/dev/bus/usb",
+			     (int)len, root) >= sizeof(devbususb) ||
+	    (size_t)snprintf(sysfs_dev_char, sizeof(sysfs_dev_char), "%.*s/sys/dev/char/",
+			     (int)len, root) >= sizeof(sysfs_dev_char)) {
+		fprintf(stderr, "%s: path too long\n", root);
+		return -1;
 	}
+	return 0;
 }
 
-static char *get_absolute_path(const char *path, char *result,
-			       size_t result_size)
+const char *sysfs_devices_path(void)
 {
-	const char *ppath;	/* pointer on the input string */
-	char *presult;		/* pointer on the output string */
-
-	ppath = path;
-	presult = result;
-	result[0] = 0;
-
-	if (path == NULL)
-		return result;
+	return sysfs_usb_devices;
+}
 
-	if (*ppath != '/') {
-		result = getcwd(result, result_size);
-		presult += strlen(result);
-		result_size -= strlen(result);
+const char *usbfs_path(void)
+{
+	return devbususb;
+}
 
-		*presult++ = '/';
-		result_size--;
+/* "usb1" or "1-2.4" to a location id */
+static int parse_device_name(const char *name, unsigned int *location_id)
+{
+	unsigned long n;
+	char *end;
+	int i;
+
+	if (!strncmp(name, "usb", 3)) {
+		n = strtoul(name + 3, &end, 10);
+		if (end == name + 3 || *end || !n || n > 255)
+			return -1;
+		*location_id = n << 24;
+		return 0;
 	}
-
-	while (*ppath != 0 && result_size > 1) {
-		if (*ppath == '/') {
-			do
-				ppath++;
-			while (*ppath == '/');
-			*presult++ = '/';
-			result_size--;
-		} else if (*ppath == '.' && *(ppath + 1) == '.' &&
-			   *(ppath + 2) == '/' && *(presult - 1) == '/') {
-			if ((presult - 1) != result) {
-				/* go one directory upper */
-				do {
-					presult--;
-					result_size++;
-				} while (*(presult - 1) != '/');
-			}
-			ppath += 3;
-		} else if (*ppath == '.'  &&
-			   *(ppath + 1) == '/' &&
-			   *(presult - 1) == '/') {
-			ppath += 2;
-		} else {
-			*presult++ = *ppath++;
-			result_size--;
-		}
+	n = strtoul(name, &end, 10);
+	if (end == name || *end != '-' || !n || n > 255)
+		return -1;
+	*location_id = n << 24;
+	for (i = 0; *end; i++) {
+		name = end + 1;
+		n = strtoul(name, &end, 10);
+		if (end == name || (*end && *end != '.') || !n || n > 15 || i > 5)
+			return -1;
+		*location_id |= n << (20 - 4 * i);
 	}
-	/* Don't forget to mark the end of the string! */
-	*presult = 0;
+	return 0;
+}
 
-	return result;
+/*
+ * What lsusb -D was given, without looking at any other device: a usbfs
+ * node's minor number is its bus and address, and /sys/dev/char links
+ * it to its sysfs directory, which names its ports.  The nodes of a made
+ * up tree are plain files, so there the numbers come from the path.
+ */
+int linux_get_usb_node(const char *path, struct usb_node *node)
+{
+	char buf[PATH_MAX], dir[PATH_MAX];
+	unsigned long bus, dev;
+	struct stat st;
+	char *p, *end;
+	ssize_t len;
+
+	if (stat(path, &st) < 0)
+		return -1;
+	if (S_ISCHR(st.st_mode)) {
+		if (major(st.st_rdev) != USB_DEVICE_MAJOR)
+			return -1;
+		node->busnum = minor(st.st_rdev) / 128 + 1;
+		node->devnum = minor(st.st_rdev) % 128 + 1;
+		node->usbfs = 1;
+	} else {
+		/* <devbususb>/BBB/DDD */
+		if (!realpath(path, buf) || !realpath(devbususb, dir))
+			return -1;
+		p = strrchr(buf, '/');
+		dev = strtoul(p + 1, &end, 10);
+		if (*end || !dev || dev > 127)
+			return -1;
+		*p = '\0';
+		p = strrchr(buf, '/');
+		bus = strtoul(p + 1, &end, 10);
+		if (*end || !bus || bus > 255)
+			return -1;
+		*p = '\0';
+		if (strcmp(buf, dir))
+			return -1;
+		node->busnum = bus;
+		node->devnum = dev;
+		node->usbfs = 0;
+	}
+	node->location_id = 0;
+	if (snprintf(buf, sizeof(buf), "%s%u:%u", sysfs_dev_char, USB_DEVICE_MAJOR,
+		     (node->busnum - 1) * 128 + node->devnum - 1) >= (int)sizeof(buf))
+		return 0;
+	len = readlink(buf, dir, sizeof(dir) - 1);
+	if (len > 0) {
+		dir[len] = '\0';
+		p = strrchr(dir, '/');
+		if (parse_device_name(p ? p + 1 : dir, &node->location_id) < 0)
+			node->location_id = 0;
+	}
+	return 0;
 }
 
-int linux_get_usb_device(libusb_device *dev, libusb_context *ctx, const char *path)
+/* without sysfs or the newer libusb calls: one pass over libusb's devices */
+libusb_device *linux_get_usb_device(libusb_context *ctx, const struct usb_node *node)
 {
-	libusb_device **list;
+	libusb_device **list, *dev = NULL;
 	ssize_t num_devs, i;
-	char device_path[PATH_MAX + 1];
-	char absolute_path[PATH_MAX + 1];
 
-	readlink_recursive(path, device_path, sizeof(device_path));
-	get_absolute_path(device_path, absolute_path, sizeof(absolute_path));
-
-	dev = NULL;
 	num_devs = libusb_get_device_list(ctx, &list);
-
 	for (i = 0; i < num_devs; ++i) {
-		uint8_t bnum = libusb_get_bus_number(list[i]);
-		uint8_t dnum = libusb_get_device_address(list[i]);
-
-		snprintf(device_path, sizeof(device_path), "%s/%03u/%03u",
-			 devbususb, bnum, dnum);
-		if (!strcmp(device_path, absolute_path)) {
-			dev = list[i];
+		if (libusb_get_bus_number(list[i]) == node->busnum &&
+		    libusb_get_device_address(list[i]) == node->devnum) {
+			dev = libusb_ref_device(list[i]);
 			break;
 		}
 	}
-
-	libusb_free_device_list(list, 0);
-	return LIBUSB_SUCCESS;
+	if (num_devs >= 0)
+		libusb_free_device_list(list, 1);
+	return dev;
 }
 
 int linux_get_device_info_path(char *path, size_t size, unsigned int location_id)
@@ -164,10 +200,10 @@ int linux_get_device_info_path(char *path, size_t size, unsigned int location_id
 	ssize_t r;
 	int i = 0;
 
-	if (size < strlen(SBUD))
+	if (size < strlen(sysfs_usb_devices))
 		return 0;
 
-	snprintf(path, size, "%s", SBUD);
+	snprintf(path, size, "%s", sysfs_usb_devices);
 
 	busnum = location_id >> 24;
 	mask = 0x00ffffff;
@@ -192,6 +228,529 @@ int linux_get_device_info_path(char *path, size_t size, unsigned int location_id
 }
 #endif
 
+/* ---------------------------------------------------------------------- */
+
+#ifdef OS_LINUX
+/*
+ * Per-device sysfs snapshots.  The device directory is opened once, the
+ * attributes everybody asks for are read from it in one pass, and the
+ * rest are read with openat() on first use.  Every value is kept for the
+ * rest of the run, so repeated queries for a device (listing, dumping,
+ * the tree view) cost nothing.
+ *
+ * Only the SYSFS_DIRFDS directories used last stay open; one per device
+ * would run out of file descriptors on a large bus.  An evicted one is
+ * opened again by path when its device needs another attribute.
+ */
+
+#define SYSFS_HASHSZ 64
+#define SYSFS_DIRFDS 32
+
+static const char *const sysfs_attr_names[SYSFS_NATTRS] = {
+	[SYSFS_MANUFACTURER] = "manufacturer",
+	[SYSFS_PRODUCT] = "product",
+	[SYSFS_SERIAL] = "serial",
+	[SYSFS_MAXCHILD] = "maxchild",
+	[SYSFS_BCDDEVICE] = "bcdDevice",
+	[SYSFS_VERSION] = "version",
+	[SYSFS_IDVENDOR] = "idVendor",
+	[SYSFS_IDPRODUCT] = "idProduct",
+	[SYSFS_BDEVICECLASS] = "bDeviceClass",
+	[SYSFS_BDEVICESUBCLASS] = "bDeviceSubClass",
+	[SYSFS_BDEVICEPROTOCOL] = "bDeviceProtocol",
+	[SYSFS_BMAXPACKETSIZE0] = "bMaxPacketSize0",
+	[SYSFS_BNUMCONFIGURATIONS] = "bNumConfigurations",
+	[SYSFS_BCONFIGURATIONVALUE] = "bConfigurationValue",
+	[SYSFS_BMATTRIBUTES] = "bmAttributes",
+	[SYSFS_BMAXPOWER] = "bMaxPower",
+	[SYSFS_BNUMINTERFACES] = "bNumInterfaces",
+	[SYSFS_CONFIGURATION] = "configuration",
+	[SYSFS_EP0_BENDPOINTADDRESS] = "ep_00/bEndpointAddress",
+	[SYSFS_EP0_BINTERVAL] = "ep_00/bInterval",
+	[SYSFS_EP0_BLENGTH] = "ep_00/bLength",
+	[SYSFS_EP0_BMATTRIBUTES] = "ep_00/bmAttributes",
+	[SYSFS_EP0_WMAXPACKETSIZE] = "ep_00/wMaxPacketSize",
+	[SYSFS_POWER_RUNTIME_STATUS] = "power/runtime_status",
+};
+
+/* read when the snapshot is taken */
+#define SYSFS_SNAPSHOT_ATTRS	((1u << SYSFS_MANUFACTURER) | (1u << SYSFS_PRODUCT) | \
+				 (1u << SYSFS_SERIAL) | (1u << SYSFS_MAXCHILD))
+
+struct sysfs_dev {
+	struct sysfs_dev *next;
+	unsigned int location_id;
+	int dirfd;			/* -1 unless among sysfs_dirs */
+	int nodir;			/* no directory to read from */
+	unsigned long dir_used;		/* when dirfd was last used */
+	char name[MY_PARAM_MAX];	/* "1-2.3", or "usb1" for a root hub */
+	unsigned int read;		/* attributes looked at so far */
+	char *attr[SYSFS_NATTRS];	/* NULL if missing or unreadable */
+	unsigned char *desc;		/* the binary "descriptors" attribute */
+	int desc_len;			/* -1 until read */
+};
+
+static struct sysfs_dev *sysfs_devs[SYSFS_HASHSZ];
+static struct sysfs_dev *sysfs_dirs[SYSFS_DIRFDS];	/* the open directories */
+static unsigned long sysfs_dir_clock;
+
+static void sysfs_dev_dir_close(unsigned int slot)
+{
+	close(sysfs_dirs[slot]->dirfd);
+	sysfs_dirs[slot]->dirfd = -1;
+	sysfs_dirs[slot] = NULL;
+}
+
+/* the device's directory, opened in place of the least recently used one */
+static int sysfs_dev_dir(struct sysfs_dev *sd)
+{
+	char path[MY_PATH_MAX];
+	unsigned int i, slot = 0;
+
+	if (sd->dirfd >= 0) {
+		sd->dir_used = ++sysfs_dir_clock;
+		return sd->dirfd;
+	}
+	if (sd->nodir)
+		return -1;
+	for (i = 0; i < SYSFS_DIRFDS; i++) {
+		if (!sysfs_dirs[i]) {
+			slot = i;
+			break;
+		}
+		if (sysfs_dirs[i]->dir_used < sysfs_dirs[slot]->dir_used)
+			slot = i;
+	}
+	if (sysfs_dirs[slot])
+		sysfs_dev_dir_close(slot);
+
+	linux_get_device_info_path(path, sizeof(path), sd->location_id);
+	sd->dirfd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (sd->dirfd < 0 && (errno == EMFILE || errno == ENFILE)) {
+		/* somebody else holds the descriptors: give up ours and retry */
+		for (i = 0; i < SYSFS_DIRFDS; i++)
+			if (sysfs_dirs[i])
+				sysfs_dev_dir_close(i);
+		sd->dirfd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	}
+	if (sd->dirfd < 0) {
+		if (errno == EMFILE || errno == ENFILE)
+			fprintf(stderr, "Cannot open %s: %s\n", path, strerror(errno));
+		else
+			sd->nodir = 1;
+		return -1;
+	}
+	sd->dir_used = ++sysfs_dir_clock;
+	sysfs_dirs[slot] = sd;
+	return sd->dirfd;
+}
+
+static void sysfs_read_attr(struct sysfs_dev *sd, enum sysfs_attr attr)
+{
+	char buf[MY_STRING_MAX];
+	u_int64_t start = timing_start();
+	ssize_t r;
+	int dirfd, fd;
+
+	sd->read |= 1u << attr;
+	if (snapshot_loaded()) {
+		const char *value = snapshot_sysfs_attr(sd->location_id, attr);
+
+		if (value)
+			sd->attr[attr] = strdup(value);
+		return;
+	}
+	dirfd = sysfs_dev_dir(sd);
+	if (dirfd < 0)
+		return;
+	fd = openat(dirfd, sysfs_attr_names[attr], O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+	r = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (start)
+		timing_record(TIMING_SYSFS, sysfs_attr_names[attr], 0, sd->location_id, start);
+	/* values end in \n, an empty one is as good as none */
+	if (r < 2)
+		return;
+	buf[r - 1] = '\0';
+	sd->attr[attr] = strdup(buf);
+}
+
+static unsigned int sysfs_hashfn(unsigned int location_id)
+{
+	return (location_id ^ (location_id >> 12)) & (SYSFS_HASHSZ - 1);
+}
+
+struct sysfs_dev *sysfs_dev_get(unsigned int location_id)
+{
+	unsigned int h = sysfs_hashfn(location_id);
+	struct sysfs_dev *sd;
+	char path[MY_PATH_MAX];
+	unsigned int attr;
+
+	for (sd = sysfs_devs[h]; sd; sd = sd->next)
+		if (sd->location_id == location_id)
+			return sd;
+
+	sd = calloc(1, sizeof(*sd));
+	if (!sd)
+		return NULL;
+	sd->location_id = location_id;
+	sd->desc_len = -1;
+	linux_get_device_info_path(path, sizeof(path), location_id);
+	if (strlen(path + strlen(sysfs_usb_devices)) < sizeof(sd->name))
+		strcpy(sd->name, path + strlen(sysfs_usb_devices));
+	sd->dirfd = -1;
+	/* a loaded snapshot has the values, this host's sysfs does not */
+	sd->nodir = snapshot_loaded();
+
+	for (attr = 0; attr < SYSFS_NATTRS; attr++)
+		if (SYSFS_SNAPSHOT_ATTRS & (1u << attr))
+			sysfs_read_attr(sd, attr);
+
+	sd->next = sysfs_devs[h];
+	sysfs_devs[h] = sd;
+	return sd;
+}
+
+const char *sysfs_dev_attr(struct sysfs_dev *sd, enum sysfs_attr attr)
+{
+	if (!sd)
+		return NULL;
+	if (!(sd->read & (1u << attr)))
+		sysfs_read_attr(sd, attr);
+	return sd->attr[attr];
+}
+
+/*
+ * 1 if runtime PM has the device suspended, or on its way there: anything
+ * that opens it would resume it.  Read once, so every part of a run sees
+ * the device in the same state.
+ */
+int sysfs_dev_suspended(struct sysfs_dev *sd)
+{
+	const char *status = sysfs_dev_attr(sd, SYSFS_POWER_RUNTIME_STATUS);
+
+	return status && (!strcmp(status, "suspended") || !strcmp(status, "suspending"));
+}
+
+/* name of the driver bound to an interface; a root hub reports its host controller's */
+int sysfs_dev_driver(struct sysfs_dev *sd, int ifnum, char *buf, size_t size)
+{
+	char link[MY_PATH_MAX];
+	char intf[MY_PARAM_MAX + 16];
+	u_int64_t start;
+	const char *p;
+	ssize_t l;
+	int dirfd;
+
+	*buf = 0;
+	if (sd && snapshot_loaded())
+		return snapshot_sysfs_driver(sd->location_id, ifnum, buf, size);
+	if (!sd || (dirfd = sysfs_dev_dir(sd)) < 0)
+		return 0;
+	if ((sd->location_id & 0x00ffffff) == 0)
+		snprintf(intf, sizeof(intf), "../driver");
+	else
+		snprintf(intf, sizeof(intf), "%s:1.%d/driver", sd->name, ifnum);
+	start = timing_start();
+	l = readlinkat(dirfd, intf, link, sizeof(link) - 1);
+	if (start)
+		timing_record(TIMING_SYSFS, "driver", 0, sd->location_id, start);
+	if (l < 0)
+		return 0;
+	link[l] = '\0';
+	p = strrchr(link, '/');
+	return snprintf(buf, size, "%s", p ? p + 1 : link);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * The "descriptors" attribute holds the device descriptor followed by
+ * every configuration descriptor set exactly as the device sent it at
+ * enumeration time.  Parsing it gives the same structures as
+ * libusb_get_config_descriptor() without opening the device.
+ */
+
+static void sysfs_read_descriptors(struct sysfs_dev *sd)
+{
+	unsigned char *buf = NULL, *tmp;
+	size_t len = 0, alloc = 0;
+	u_int64_t start = timing_start();
+	ssize_t r;
+	int dirfd, fd;
+
+	sd->desc_len = 0;
+	dirfd = sysfs_dev_dir(sd);
+	if (dirfd < 0)
+		return;
+	fd = openat(dirfd, "descriptors", O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+	do {
+		if (len == alloc) {
+			alloc = alloc ? 2 * alloc : 4096;
+			tmp = realloc(buf, alloc);
+			if (!tmp) {
+				free(buf);
+				close(fd);
+				return;
+			}
+			buf = tmp;
+		}
+		r = read(fd, buf + len, alloc - len);
+		if (r > 0)
+			len += r;
+	} while (r > 0);
+	close(fd);
+	if (start)
+		timing_record(TIMING_SYSFS, "descriptors", 0, sd->location_id, start);
+	if (r < 0 || len > INT_MAX) {
+		free(buf);
+		return;
+	}
+	sd->desc = buf;
+	sd->desc_len = len;
+}
+
+/* configuration index as the kernel stored it, for as long as sd lives */
+int sysfs_get_config_raw(struct sysfs_dev *sd, int index,
+			 const unsigned char **buf, int *buflen)
+{
+	const unsigned char *p, *end;
+	int len;
+
+	*buf = NULL;
+	*buflen = 0;
+	if (!sd)
+		return LIBUSB_ERROR_NOT_FOUND;
+	if (sd->desc_len < 0)
+		sysfs_read_descriptors(sd);
+	if (sd->desc_len < LIBUSB_DT_DEVICE_SIZE)
+		return LIBUSB_ERROR_NOT_FOUND;
+
+	p = sd->desc + sd->desc[0];
+	end = sd->desc + sd->desc_len;
+	for (;;) {
+		if (end - p < LIBUSB_DT_CONFIG_SIZE || p[1] != LIBUSB_DT_CONFIG)
+			return LIBUSB_ERROR_NOT_FOUND;
+		len = p[2] | (p[3] << 8);
+		if (len < LIBUSB_DT_CONFIG_SIZE)
+			return LIBUSB_ERROR_IO;
+		/* the kernel stores no more than it got */
+		if (len > end - p)
+			len = end - p;
+		if (!index--)
+			break;
+		p += len;
+	}
+	*buf = p;
+	*buflen = len;
+	return LIBUSB_SUCCESS;
+}
+
+int sysfs_get_config_descriptor(struct sysfs_dev *sd, int index,
+				struct libusb_config_descriptor **config)
+{
+	const unsigned char *p;
+	int len, ret;
+
+	*config = NULL;
+	ret = sysfs_get_config_raw(sd, index, &p, &len);
+	if (ret)
+		return ret;
+	*config = parse_config_descriptor(p, len);
+	return *config ? LIBUSB_SUCCESS : LIBUSB_ERROR_NO_MEM;
+}
+
+static void sysfs_dev_free(struct sysfs_dev *sd)
+{
+	unsigned int attr, i;
+
+	for (i = 0; i < SYSFS_DIRFDS; i++)
+		if (sysfs_dirs[i] == sd)
+			sysfs_dev_dir_close(i);
+	for (attr = 0; attr < SYSFS_NATTRS; attr++)
+		free(sd->attr[attr]);
+	free(sd->desc);
+	free(sd);
+}
+
+/* the device at location_id is gone, another one may take its place */
+void sysfs_dev_forget(unsigned int location_id)
+{
+	struct sysfs_dev **p = &sysfs_devs[sysfs_hashfn(location_id)];
+	struct sysfs_dev *sd;
+
+	while ((sd = *p)) {
+		if (sd->location_id == location_id) {
+			*p = sd->next;
+			sysfs_dev_free(sd);
+			return;
+		}
+		p = &sd->next;
+	}
+}
+
+void sysfs_dev_release_all(void)
+{
+	struct sysfs_dev *sd, *next;
+	unsigned int h;
+
+	for (h = 0; h < SYSFS_HASHSZ; h++) {
+		for (sd = sysfs_devs[h]; sd; sd = next) {
+			next = sd->next;
+			sysfs_dev_free(sd);
+		}
+		sysfs_devs[h] = NULL;
+	}
+}
+#endif
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * Configuration descriptors as a device sends them, parsed into the
+ * structures libusb_get_config_descriptor() gives.  Used for the copy
+ * sysfs keeps and for saved snapshots.
+ */
+
+struct parsed_config {
+	struct libusb_config_descriptor config;	/* must be first */
+	unsigned char raw[];			/* extra descriptors point in here */
+};
+
+static void add_extra(const unsigned char **extra, int *extra_length,
+		      const unsigned char *p)
+{
+	if (!*extra)
+		*extra = p;
+	*extra_length += p[0];
+}
+
+struct libusb_config_descriptor *parse_config_descriptor(const unsigned char *buf, int len)
+{
+	struct parsed_config *sc;
+	struct libusb_config_descriptor *config;
+	struct libusb_interface *intfs;
+	struct libusb_interface_descriptor *alt = NULL;
+	struct libusb_endpoint_descriptor *ep = NULL;
+	const unsigned char *p, *end;
+	int nintf = 0, neps = 0, dropped = 0;
+
+	sc = calloc(1, sizeof(*sc) + len);
+	if (!sc)
+		return NULL;
+	memcpy(sc->raw, buf, len);
+	p = sc->raw;
+	end = p + len;
+
+	config = &sc->config;
+	config->bLength = p[0];
+	config->bDescriptorType = p[1];
+	config->wTotalLength = p[2] | (p[3] << 8);
+	config->bNumInterfaces = p[4];
+	config->bConfigurationValue = p[5];
+	config->iConfiguration = p[6];
+	config->bmAttributes = p[7];
+	config->MaxPower = p[8];
+	intfs = calloc(config->bNumInterfaces ? config->bNumInterfaces : 1, sizeof(*intfs));
+	if (!intfs) {
+		free(sc);
+		return NULL;
+	}
+	config->interface = intfs;
+
+	for (p += p[0]; p + 2 <= end && p[0] >= 2 && p + p[0] <= end; p += p[0]) {
+		if (p[1] == LIBUSB_DT_INTERFACE && p[0] >= 9) {
+			struct libusb_interface *intf;
+			struct libusb_interface_descriptor *alts;
+
+			/* a new interface number starts a new interface */
+			if (!nintf || intfs[nintf - 1].altsetting[0].bInterfaceNumber != p[2]) {
+				if (nintf == config->bNumInterfaces) {
+					alt = NULL;
+					ep = NULL;
+					dropped = 1;
+					continue;
+				}
+				nintf++;
+			}
+			dropped = 0;
+			intf = &intfs[nintf - 1];
+			alts = realloc((void *)intf->altsetting,
+				       (intf->num_altsetting + 1) * sizeof(*alts));
+			if (!alts)
+				goto fail;
+			intf->altsetting = alts;
+			alt = &alts[intf->num_altsetting++];
+			memset(alt, 0, sizeof(*alt));
+			alt->bLength = p[0];
+			alt->bDescriptorType = p[1];
+			alt->bInterfaceNumber = p[2];
+			alt->bAlternateSetting = p[3];
+			alt->bInterfaceClass = p[5];
+			alt->bInterfaceSubClass = p[6];
+			alt->bInterfaceProtocol = p[7];
+			alt->iInterface = p[8];
+			alt->endpoint = calloc(p[4] ? p[4] : 1, sizeof(*alt->endpoint));
+			if (!alt->endpoint)
+				goto fail;
+			/* bNumEndpoints counts the ones actually there */
+			neps = p[4];
+			ep = NULL;
+		} else if (dropped) {
+			/* what follows an interface with no room belongs to it */
+			continue;
+		} else if (p[1] == LIBUSB_DT_ENDPOINT && p[0] >= 7 && alt &&
+			   alt->bNumEndpoints < neps) {
+			ep = (struct libusb_endpoint_descriptor *)&alt->endpoint[alt->bNumEndpoints++];
+			ep->bLength = p[0];
+			ep->bDescriptorType = p[1];
+			ep->bEndpointAddress = p[2];
+			ep->bmAttributes = p[3];
+			ep->wMaxPacketSize = p[4] | (p[5] << 8);
+			ep->bInterval = p[6];
+			if (p[0] >= 9) {
+				ep->bRefresh = p[7];
+				ep->bSynchAddress = p[8];
+			}
+		} else if (ep) {
+			add_extra(&ep->extra, &ep->extra_length, p);
+		} else if (alt) {
+			add_extra(&alt->extra, &alt->extra_length, p);
+		} else {
+			add_extra(&config->extra, &config->extra_length, p);
+		}
+	}
+	/* like libusb, only count the interfaces actually found */
+	config->bNumInterfaces = nintf;
+	return config;
+
+fail:
+	free_parsed_config(config);
+	return NULL;
+}
+
+void free_parsed_config(struct libusb_config_descriptor *config)
+{
+	int i, j;
+
+	if (!config)
+		return;
+	for (i = 0; i < config->bNumInterfaces; i++) {
+		const struct libusb_interface *intf = &config->interface[i];
+
+		for (j = 0; j < intf->num_altsetting; j++)
+			free((void *)intf->altsetting[j].endpoint);
+		free((void *)intf->altsetting);
+	}
+	free((void *)config->interface);
+	free((struct parsed_config *)config);
+}
+
 /*
 This call is to get a cached descriptor string, and thus is OS-dependent.
 It is not for use in two special cases that are not in the descriptors:
@@ -203,176 +762,356 @@ int get_string_from_cache(char *buf, size_t size, libusb_device *dev, unsigned i
 {
 	/* referrer is something like LIBUSB_DEVICE_BCDUSB */
 	/* return is length of string in buf */
-	const char *cacheID;
-	int fd, r;
-	unsigned int location_id;
-	char path[MY_PATH_MAX];
+	enum sysfs_attr attr;
+	const char *value;
 
 	if (size < 1)
 		return LIBUSB_SUCCESS;
 	*buf = 0;
-	path[0] = '\0';
-	location_id = get_location_id(dev);
-
-	linux_get_device_info_path(path, sizeof(path), location_id);
-	snprintf(path + strlen(path), size - strlen(path), "%s", "/");
 
 	switch (referrer) {
 	case LIBUSB_HUB_N_NBRPORTS:
-		cacheID = "/maxchild"; break;
+		attr = SYSFS_MAXCHILD; break;
 	case LIBUSB_DEVICE_BCD_DEVICE:
-		cacheID = "/bcdDevice"; break;
+		attr = SYSFS_BCDDEVICE; break;
 	case LIBUSB_CONFIG_B_CONFIGURATIONVALUE:
-		cacheID = "/bConfigurationValue"; break;
+		attr = SYSFS_BCONFIGURATIONVALUE; break;
 	case LIBUSB_DEVICE_B_DEVICECLASS:
-		cacheID = "/bDeviceClass"; break;
+		attr = SYSFS_BDEVICECLASS; break;
 	case LIBUSB_DEVICE_B_DEVICEPROTOCOL:
-		cacheID = "/bDeviceProtocol"; break;
+		attr = SYSFS_BDEVICEPROTOCOL; break;
 	case LIBUSB_DEVICE_B_DEVICESUBCLASS:
-		cacheID = "/bDeviceSubClass"; break;
+		attr = SYSFS_BDEVICESUBCLASS; break;
 	case LIBUSB_CONFIG_BM_ATTRIBUTES:
-		cacheID = "/bmAttributes"; break;
+		attr = SYSFS_BMATTRIBUTES; break;
 	case LIBUSB_DEVICE_B_MAXPACKETSIZE0:
-		cacheID = "/bMaxPacketSize0"; break;
+		attr = SYSFS_BMAXPACKETSIZE0; break;
 	case LIBUSB_CONFIG_B_MAXPOWER:
-		cacheID = "/bMaxPower"; break;
+		attr = SYSFS_BMAXPOWER; break;
 	case LIBUSB_DEVICE_B_NUMCONFIGURATIONS:
-		cacheID = "/bNumConfigurations"; break;
+		attr = SYSFS_BNUMCONFIGURATIONS; break;
 	case LIBUSB_CONFIG_B_NUMINTERFACES:
-		cacheID = "/bNumInterfaces"; break;
+		attr = SYSFS_BNUMINTERFACES; break;
 	case LIBUSB_CONFIG_S_CONFIGURATION:
-		cacheID = "/configuration"; break;
+		attr = SYSFS_CONFIGURATION; break;
 	case LIBUSB_DEVICE_ID_PRODUCT:
-		cacheID = "/idProduct"; break;
+		attr = SYSFS_IDPRODUCT; break;
 	case LIBUSB_DEVICE_ID_VENDOR:
-		cacheID = "/idVendor"; break;
+		attr = SYSFS_IDVENDOR; break;
 	case LIBUSB_DEVICE_BCD_USB:
-		cacheID = "/version"; break;
+		attr = SYSFS_VERSION; break;
 	case LIBUSB_DEVICE_S_MANUFACTURER:
-		cacheID = "/manufacturer"; break;
+		attr = SYSFS_MANUFACTURER; break;
 	case LIBUSB_DEVICE_S_PRODUCT:
-		cacheID = "/product"; break;
+		attr = SYSFS_PRODUCT; break;
 	case LIBUSB_DEVICE_S_SERIALNUMBER:
-		cacheID = "/serial"; break;
+		attr = SYSFS_SERIAL; break;
 	case LIBUSB_ENDPOINT_B_ENDPOINTADDRESS:
-		cacheID = "/ep00/bEndpointAddress"; break;
+		attr = SYSFS_EP0_BENDPOINTADDRESS; break;
 	case LIBUSB_ENDPOINT_B_INTERVAL:
-		cacheID = "/ep00/bInterval"; break;
+		attr = SYSFS_EP0_BINTERVAL; break;
 	case LIBUSB_ENDPOINT_B_LENGTH:
-		cacheID = "/ep00/bLength"; break;
+		attr = SYSFS_EP0_BLENGTH; break;
 	case LIBUSB_ENDPOINT_BM_ATTRIBUTES:
-		cacheID = "/ep00/bmAttributes"; break;
+		attr = SYSFS_EP0_BMATTRIBUTES; break;
 	case LIBUSB_ENDPOINT_W_MAXPACKETSIZE:
-		cacheID = "/ep00/wMaxPacketSize"; break; /* hex */
+		attr = SYSFS_EP0_WMAXPACKETSIZE; break; /* hex */
+	default:
+		return 0;
 	}
 
-	strncat(path, cacheID, sizeof(path) - strlen(path) - 1);
-	fd = open(path, O_RDONLY);
-	if (fd < 0)
-		return 0;
-	r = read(fd, buf, size - 1);
-	close(fd);
-	if (r < 0)
+	value = sysfs_dev_attr(sysfs_dev_get(get_location_id(dev)), attr);
+	if (!value)
 		return 0;
+	return snprintf(buf, size, "%s", value);
+}
 
-	/* buf has \n appended */
-	if (r < 2)
-		return 0;
+#endif
 
-	buf[r - 1] = '\0';
-	return strlen(buf);
+/*
+ * Strings read from a device, per open handle.  Each index is read and
+ * converted once however often the dump shows it, and the language ID
+ * is only asked for once per device.  A failed read is not kept, so the
+ * next use asks the device again.
+ */
+
+#define STRING_HASHSZ	64
+
+struct string_cache {
+	struct string_cache *next;
+	libusb_device_handle *hdev;
+	int langid;		/* -1 until known */
+	char *str[256];		/* as printed, NULL until read */
+};
+
+static struct string_cache *string_hash[STRING_HASHSZ];
+
+static unsigned int string_hashfn(libusb_device_handle *hdev)
+{
+	unsigned long h = (unsigned long)hdev;
+
+	return (h ^ (h >> 9)) & (STRING_HASHSZ - 1);
 }
 
-#endif
+static struct string_cache *string_cache_get(libusb_device_handle *hdev)
+{
+	struct string_cache **head = &string_hash[string_hashfn(hdev)];
+	struct string_cache *sc;
+
+	for (sc = *head; sc; sc = sc->next)
+		if (sc->hdev == hdev)
+			return sc;
+	sc = calloc(1, sizeof(*sc));
+	if (!sc)
+		return NULL;
+	sc->hdev = hdev;
+	sc->langid = -1;
+	sc->next = *head;
+	*head = sc;
+	return sc;
+}
 
-static void get_dev_string_ascii(char *buf, size_t size, libusb_device_handle *dev,
-				  u_int8_t id)
+/* handles get reused once closed, so this must be called before closing */
+void free_dev_strings(libusb_device_handle *hdev)
 {
-	int ret = libusb_get_string_descriptor_ascii(dev, id,
+	struct string_cache **pp = &string_hash[string_hashfn(hdev)];
+	struct string_cache *sc;
+	unsigned int i;
+
+	for (; (sc = *pp); pp = &sc->next)
+		if (sc->hdev == hdev)
+			break;
+	if (!sc)
+		return;
+	*pp = sc->next;
+	for (i = 0; i < 256; i++)
+		free(sc->str[i]);
+	free(sc);
+}
+
+static int get_dev_string_ascii(char *buf, size_t size, libusb_device_handle *dev,
+				 u_int8_t id)
+{
+	int ret = snapshot_loaded() ? LIBUSB_ERROR_NOT_FOUND :
+		libusb_get_string_descriptor_ascii(dev, id,
 	                                             (unsigned char *) buf,
 	                                             size);
 
 	if (ret < 0) {
 		snprintf(buf, size, "%s", "(error)");
+		return -1;
 	}
-
+	return 0;
 }
 
 #if defined(HAVE_NL_LANGINFO) && defined(HAVE_ICONV)
-static u_int16_t get_any_langid(libusb_device_handle *dev)
+#define STRING_DESC_MAX	254
+#define STRING_TIMEOUT	1000	/* milliseconds, as libusb uses */
+
+/* libusb_get_string_descriptor(), but able to use prefetched results */
+static int get_string_descriptor(libusb_device_handle *dev, u_int8_t id,
+				 u_int16_t langid, unsigned char *buf, int size)
+{
+	return xfer_control(dev, LIBUSB_ENDPOINT_IN, LIBUSB_REQUEST_GET_DESCRIPTOR,
+			    (LIBUSB_DT_STRING << 8) | id, langid, buf, size,
+			    STRING_TIMEOUT);
+}
+
+static u_int16_t get_any_langid(struct string_cache *sc, libusb_device_handle *dev)
 {
 	unsigned char buf[4];
-	int ret = libusb_get_string_descriptor(dev, 0, 0, buf, sizeof buf);
+	int ret;
+
+	if (sc && sc->langid >= 0)
+		return sc->langid;
+	ret = get_string_descriptor(dev, 0, 0, buf, sizeof buf);
 	if (ret != sizeof buf) return 0;
+	if (sc)
+		sc->langid = buf[2] | (buf[3] << 8);
 	return buf[2] | (buf[3] << 8);
 }
 
-static char *usb_string_to_native(char * str, size_t len)
+struct string_ids {
+	unsigned int n;
+	u_int8_t id[];
+};
+
+static void prefetch_string_ids(libusb_device_handle *hdev, u_int16_t langid,
+				const struct string_ids *ids)
+{
+	unsigned int i;
+
+	for (i = 0; langid && i < ids->n; i++)
+		xfer_prefetch(hdev, LIBUSB_ENDPOINT_IN, LIBUSB_REQUEST_GET_DESCRIPTOR,
+			      (LIBUSB_DT_STRING << 8) | ids->id[i], langid,
+			      STRING_DESC_MAX, STRING_TIMEOUT, NULL, NULL);
+}
+
+static void prefetch_strings(libusb_device_handle *hdev, int status,
+			     const unsigned char *data, void *user_data)
+{
+	struct string_ids *ids = user_data;
+	struct string_cache *sc;
+	u_int16_t langid;
+
+	if (status == 4) {
+		langid = data[2] | (data[3] << 8);
+		sc = string_cache_get(hdev);
+		if (sc)
+			sc->langid = langid;
+		prefetch_string_ids(hdev, langid, ids);
+	}
+	free(ids);
+}
+#endif
+
+/* queue the reads get_dev_string() will do for these string indexes */
+void prefetch_dev_strings(libusb_device_handle *hdev, const u_int8_t *id, unsigned int n)
+{
+#if defined(HAVE_NL_LANGINFO) && defined(HAVE_ICONV)
+	struct string_cache *sc;
+	struct string_ids *ids;
+	unsigned char seen[256];
+	unsigned int i;
+
+	if (!hdev || !n)
+		return;
+	sc = string_cache_get(hdev);
+	ids = malloc(sizeof(*ids) + n);
+	if (!ids)
+		return;
+	memset(seen, 0, sizeof(seen));
+	ids->n = 0;
+	for (i = 0; i < n; i++) {
+		if (!id[i] || seen[id[i]] || (sc && sc->str[id[i]]))
+			continue;
+		seen[id[i]] = 1;
+		ids->id[ids->n++] = id[i];
+	}
+	if (!ids->n) {
+		free(ids);
+		return;
+	}
+	if (sc && sc->langid >= 0) {
+		prefetch_string_ids(hdev, sc->langid, ids);
+		free(ids);
+		return;
+	}
+	/* the strings themselves need the language ID first */
+	xfer_prefetch(hdev, LIBUSB_ENDPOINT_IN, LIBUSB_REQUEST_GET_DESCRIPTOR,
+		      LIBUSB_DT_STRING << 8, 0, 4, STRING_TIMEOUT,
+		      prefetch_strings, ids);
+#endif
+}
+
+#if defined(HAVE_NL_LANGINFO) && defined(HAVE_ICONV)
+
+/* one converter for the whole run, reset before each string */
+static iconv_t string_conv = (iconv_t) -1;
+
+static int usb_string_to_native(char *str, size_t len, char *out, size_t out_size)
 {
 	size_t num_converted;
-	iconv_t conv;
-	char *result, *result_end;
+	char *result_end = out;
 	size_t in_bytes_left, out_bytes_left;
 
-	conv = iconv_open(nl_langinfo(CODESET), "UTF-16LE");
-
-	if (conv == (iconv_t) -1)
-		return NULL;
+	if (string_conv == (iconv_t) -1)
+		string_conv = iconv_open(nl_langinfo(CODESET), "UTF-16LE");
+	if (string_conv == (iconv_t) -1)
+		return -1;
+	iconv(string_conv, NULL, NULL, NULL, NULL);
 
 	in_bytes_left = len * 2;
-	out_bytes_left = len * MB_CUR_MAX;
-	result = result_end = malloc(out_bytes_left + 1);
-
-	num_converted = iconv(conv, &str, &in_bytes_left,
+	out_bytes_left = out_size - 1;
+	num_converted = iconv(string_conv, &str, &in_bytes_left,
 			      &result_end, &out_bytes_left);
-
-	iconv_close(conv);
-	if (num_converted == (size_t) -1) {
-		free(result);
-		return NULL;
-	}
+	if (num_converted == (size_t) -1)
+		return -1;
 
 	*result_end = 0;
-	return result;
+	return 0;
 }
 #endif
 
-int get_dev_string(char *buf, size_t size, libusb_device_handle *hdev, u_int8_t id)
+/* 0 with the string in buf, or -1 with "(error)" there */
+static int read_dev_string(char *buf, size_t size, struct string_cache *sc,
+			   libusb_device_handle *hdev, u_int8_t id)
 {
 #if defined(HAVE_NL_LANGINFO) && defined(HAVE_ICONV)
 	int ret;
-	unsigned char unicode_buf[254];
+	unsigned char unicode_buf[STRING_DESC_MAX];
 	u_int16_t langid;
-#endif
 
-	if (!hdev || !id) {
-		return 0;
-	}
-#if defined(HAVE_NL_LANGINFO) && defined(HAVE_ICONV)
-	langid = get_any_langid(hdev);
+	langid = get_any_langid(sc, hdev);
 	if (!langid) {
-		return snprintf(buf, size, "%s", "(error)");
+		snprintf(buf, size, "%s", "(error)");
+		return -1;
 	}
 
-	ret = libusb_get_string_descriptor(hdev, id, langid,
-					   (unsigned char *) unicode_buf,
-					   sizeof unicode_buf);
+	ret = get_string_descriptor(hdev, id, langid,
+				    (unsigned char *) unicode_buf,
+				    sizeof unicode_buf);
 	if (ret < 2) {
-		return snprintf(buf, size, "%s", "(error)");
+		snprintf(buf, size, "%s", "(error)");
+		return -1;
 	}
-	char *tmp = usb_string_to_native(unicode_buf + 2,
-				   ((unsigned char) unicode_buf[0] - 2) / 2);
+	if (usb_string_to_native((char *) unicode_buf + 2,
+				 ((unsigned char) unicode_buf[0] - 2) / 2,
+				 buf, size) < 0)
+		return get_dev_string_ascii(buf, size, hdev, id);
+	return 0;
+#else
+	return get_dev_string_ascii(buf, size, hdev, id);
+#endif
+}
 
-	if (tmp) {
-		snprintf(buf, size, "%s", tmp);
-		free(tmp);
-	} else {
-		get_dev_string_ascii(buf, size, hdev, id);
+int get_dev_string(char *buf, size_t size, libusb_device_handle *hdev, u_int8_t id)
+{
+	/* descriptors hold 126 UTF-16 characters at most */
+	char str[126 * MB_LEN_MAX + 1];
+	struct string_cache *sc;
+	u_int64_t start;
+	int ret;
+
+	if (!hdev || !id) {
+		return 0;
 	}
+	sc = string_cache_get(hdev);
+	if (sc && sc->str[id]) {
+		snprintf(buf, size, "%s", sc->str[id]);
+		return strlen(buf);
+	}
+
+	start = timing_start();
+	ret = read_dev_string(str, sizeof(str), sc, hdev, id);
+	if (start)
+		timing_record(TIMING_STRING, NULL, id,
+			      get_location_id(usbdev_get_device(hdev)), start);
+	if (sc && !ret)
+		sc->str[id] = strdup(str);
+	snprintf(buf, size, "%s", str);
 	return strlen(buf);
-#else
-	get_dev_string_ascii(buf, size, hdev, id);
-	return strlen(buf);
+}
+
+/* every handle's strings, and the converter they shared */
+void string_cache_release_all(void)
+{
+	struct string_cache *sc;
+	unsigned int i, j;
+
+	for (i = 0; i < STRING_HASHSZ; i++) {
+		while ((sc = string_hash[i])) {
+			string_hash[i] = sc->next;
+			for (j = 0; j < 256; j++)
+				free(sc->str[j]);
+			free(sc);
+		}
+	}
+#if defined(HAVE_NL_LANGINFO) && defined(HAVE_ICONV)
+	if (string_conv != (iconv_t) -1) {
+		iconv_close(string_conv);
+		string_conv = (iconv_t) -1;
+	}
 #endif
 }
 
@@ -380,15 +1119,182 @@ unsigned int get_location_id(libusb_device *dev)
 {
 	uint8_t port_numbers[7];
 	int j;
-	int count = libusb_get_port_numbers(dev,port_numbers, 7);
+	int count = usbdev_get_port_numbers(dev,port_numbers, 7);
 	unsigned int location_id = 0;
 	for (j = 0; j < count; j++) {
 		location_id |= (port_numbers[j] & 0xf) << (20 - 4*j);
 	}
-	location_id |= (libusb_get_bus_number(dev) << 24);
+	location_id |= (usbdev_get_bus_number(dev) << 24);
 	return location_id;
 }
 
+/* the name sysfs gives the device: "usb1" for a root hub, else "1-2.4" */
+int get_port_path(libusb_device *dev, char *buf, size_t size)
+{
+	uint8_t ports[7];
+	int n, i;
+	size_t len;
+
+	n = usbdev_get_port_numbers(dev, ports, sizeof(ports));
+	if (n <= 0)
+		return snprintf(buf, size, "usb%u", usbdev_get_bus_number(dev));
+	len = snprintf(buf, size, "%u", usbdev_get_bus_number(dev));
+	for (i = 0; i < n && len < size; i++)
+		len += snprintf(buf + len, size - len, "%c%u", i ? '.' : '-', ports[i]);
+	return len;
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * Parsed configurations, per device.  Each configuration is parsed once
+ * per run and then shared by everything that looks at it: the verbose
+ * dump, OTG detection, the tree view.  The cache holds a reference on
+ * the device until config_cache_release_all().
+ */
+
+#define CONFIG_HASHSZ	64
+
+struct config_slot {
+	int ret;		/* > 0 until parsed */
+	int parsed;		/* by parse_config_descriptor(), not libusb */
+	struct libusb_config_descriptor *config;
+};
+
+struct config_cache {
+	struct config_cache *next;
+	libusb_device *dev;
+	unsigned int nconfigs;
+	struct config_slot slot[];
+};
+
+static struct config_cache *config_hash[CONFIG_HASHSZ];
+#ifdef OS_LINUX
+static int config_sysfs;
+#endif
+
+#ifdef OS_LINUX
+/* read configurations from sysfs rather than through libusb */
+void config_cache_use_sysfs(int on)
+{
+	config_sysfs = on;
+}
+#endif
+
+static unsigned int config_hashfn(libusb_device *dev)
+{
+	unsigned long h = (unsigned long)dev;
+
+	return (h ^ (h >> 9)) & (CONFIG_HASHSZ - 1);
+}
+
+static struct config_cache *config_cache_get(libusb_device *dev)
+{
+	struct config_cache **head = &config_hash[config_hashfn(dev)];
+	struct libusb_device_descriptor desc;
+	struct config_cache *cc;
+	unsigned int i;
+
+	for (cc = *head; cc; cc = cc->next)
+		if (cc->dev == dev)
+			return cc;
+	if (usbdev_get_device_descriptor(dev, &desc) < 0)
+		return NULL;
+	cc = malloc(sizeof(*cc) + desc.bNumConfigurations * sizeof(cc->slot[0]));
+	if (!cc)
+		return NULL;
+	cc->dev = usbdev_ref_device(dev);
+	cc->nconfigs = desc.bNumConfigurations;
+	for (i = 0; i < cc->nconfigs; i++) {
+		cc->slot[i].ret = 1;
+		cc->slot[i].parsed = 0;
+		cc->slot[i].config = NULL;
+	}
+	cc->next = *head;
+	*head = cc;
+	return cc;
+}
+
+/*
+ * libusb_get_config_descriptor(), but the result belongs to the cache
+ * and must not be freed.  Failures are remembered as well.
+ */
+int get_config(libusb_device *dev, int index, struct libusb_config_descriptor **config)
+{
+	struct config_cache *cc = config_cache_get(dev);
+	struct config_slot *slot;
+
+	*config = NULL;
+	if (!cc)
+		return LIBUSB_ERROR_NO_MEM;
+	if (index < 0 || (unsigned int)index >= cc->nconfigs)
+		return LIBUSB_ERROR_NOT_FOUND;
+	slot = &cc->slot[index];
+	if (slot->ret > 0) {
+		slot->parsed = 1;
+		if (snapshot_loaded())
+			slot->ret = snapshot_get_config(dev, index, &slot->config);
+#ifdef OS_LINUX
+		else if (config_sysfs)
+			slot->ret = sysfs_get_config_descriptor(sysfs_dev_get(get_location_id(dev)),
+								index, &slot->config);
+#endif
+		else {
+			slot->parsed = 0;
+			slot->ret = libusb_get_config_descriptor(dev, index, &slot->config);
+		}
+		if (slot->ret)
+			slot->config = NULL;
+	}
+	*config = slot->config;
+	return slot->ret;
+}
+
+static void config_cache_free(struct config_cache *cc)
+{
+	unsigned int j;
+
+	for (j = 0; j < cc->nconfigs; j++) {
+		if (!cc->slot[j].config)
+			continue;
+		if (cc->slot[j].parsed)
+			free_parsed_config(cc->slot[j].config);
+		else
+			libusb_free_config_descriptor(cc->slot[j].config);
+	}
+	usbdev_unref_device(cc->dev);
+	free(cc);
+}
+
+/* drops what is cached for a device that went away */
+void config_cache_forget(libusb_device *dev)
+{
+	struct config_cache **p = &config_hash[config_hashfn(dev)];
+	struct config_cache *cc;
+
+	while ((cc = *p)) {
+		if (cc->dev == dev) {
+			*p = cc->next;
+			config_cache_free(cc);
+			return;
+		}
+		p = &cc->next;
+	}
+}
+
+void config_cache_release_all(void)
+{
+	struct config_cache *cc;
+	unsigned int i;
+
+	for (i = 0; i < CONFIG_HASHSZ; i++) {
+		while ((cc = config_hash[i])) {
+			config_hash[i] = cc->next;
+			config_cache_free(cc);
+		}
+	}
+}
+
 #ifdef OS_DARWIN
 SInt32 GetSInt32CFProperty(io_service_t obj, CFStringRef key)
 {
@@ -34,14 +34,86 @@
 
 #ifdef OS_LINUX
 #define SBUD "/sys/bus/usb/devices/"
+extern int sysfs_set_root(const char *root);
+extern const char *sysfs_devices_path(void);
+extern const char *usbfs_path(void);
 extern int linux_get_device_info_path(char *buf, size_t size, unsigned int location_id);
-extern int linux_get_usb_device(libusb_device *dev, libusb_context *ctx, const char *path);
+
+/* a /dev/bus/usb node, see linux_get_usb_node() */
+#define USB_DEVICE_MAJOR 189
+struct usb_node {
+	unsigned int busnum, devnum;
+	unsigned int location_id;	/* 0 if sysfs does not know it */
+	int usbfs;			/* a real node, which libusb can open */
+};
+
+extern int linux_get_usb_node(const char *path, struct usb_node *node);
+extern libusb_device *linux_get_usb_device(libusb_context *ctx, const struct usb_node *node);
+
+/* libusb can open a device from its node without looking for the others */
+#if defined(LIBUSB_API_VERSION) && LIBUSB_API_VERSION >= 0x01000108
+#define HAVE_LIBUSB_WRAP_SYS_DEVICE 1
+#endif
+
+enum sysfs_attr {
+	SYSFS_MANUFACTURER,
+	SYSFS_PRODUCT,
+	SYSFS_SERIAL,
+	SYSFS_MAXCHILD,
+	SYSFS_BCDDEVICE,
+	SYSFS_VERSION,
+	SYSFS_IDVENDOR,
+	SYSFS_IDPRODUCT,
+	SYSFS_BDEVICECLASS,
+	SYSFS_BDEVICESUBCLASS,
+	SYSFS_BDEVICEPROTOCOL,
+	SYSFS_BMAXPACKETSIZE0,
+	SYSFS_BNUMCONFIGURATIONS,
+	SYSFS_BCONFIGURATIONVALUE,
+	SYSFS_BMATTRIBUTES,
+	SYSFS_BMAXPOWER,
+	SYSFS_BNUMINTERFACES,
+	SYSFS_CONFIGURATION,
+	SYSFS_EP0_BENDPOINTADDRESS,
+	SYSFS_EP0_BINTERVAL,
+	SYSFS_EP0_BLENGTH,
+	SYSFS_EP0_BMATTRIBUTES,
+	SYSFS_EP0_WMAXPACKETSIZE,
+	/* runtime power management; now, not the device's, so never saved */
+	SYSFS_POWER_RUNTIME_STATUS,
+	SYSFS_NATTRS
+};
+
+#define SYSFS_NSAVED	SYSFS_POWER_RUNTIME_STATUS
+
+struct sysfs_dev;
+
+extern struct sysfs_dev *sysfs_dev_get(unsigned int location_id);
+extern const char *sysfs_dev_attr(struct sysfs_dev *sd, enum sysfs_attr attr);
+extern int sysfs_dev_driver(struct sysfs_dev *sd, int ifnum, char *buf, size_t size);
+extern int sysfs_dev_suspended(struct sysfs_dev *sd);
+extern int sysfs_get_config_raw(struct sysfs_dev *sd, int index,
+				const unsigned char **buf, int *buflen);
+extern int sysfs_get_config_descriptor(struct sysfs_dev *sd, int index,
+				       struct libusb_config_descriptor **config);
+extern void sysfs_dev_forget(unsigned int location_id);
+extern void sysfs_dev_release_all(void);
+extern void config_cache_use_sysfs(int on);
 #endif
 
 /* ---------------------------------------------------------------------- */
 
+extern struct libusb_config_descriptor *parse_config_descriptor(const unsigned char *buf, int len);
+extern void free_parsed_config(struct libusb_config_descriptor *config);
 extern int get_dev_string(char *buf, size_t size, libusb_device_handle *hdev, u_int8_t id);
+extern void prefetch_dev_strings(libusb_device_handle *hdev, const u_int8_t *id, unsigned int n);
+extern void free_dev_strings(libusb_device_handle *hdev);
+extern void string_cache_release_all(void);
 extern unsigned int get_location_id(libusb_device *dev);
+extern int get_port_path(libusb_device *dev, char *buf, size_t size);
+extern int get_config(libusb_device *dev, int index, struct libusb_config_descriptor **config);
+extern void config_cache_forget(libusb_device *dev);
+extern void config_cache_release_all(void);
 extern int get_string_from_cache(char *buf, size_t size, libusb_device *dev, unsigned int referrer);
 
 #ifdef OS_DARWIN
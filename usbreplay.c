@@ -0,0 +1,811 @@
+/*****************************************************************************/
+
+/*
+ *      usbreplay.c  --  libusb calls answered from a recording or a sysfs tree
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <libusb.h>
+
+#include "snapshot.h"
+#include "usbmisc.h"
+
+/*
+ * lsusb-replay is lsusb linked against this file instead of libusb.  On
+ * libusb_init() it loads the snapshot named by $LSUSB_REPLAY, written
+ * earlier by "lsusb --save" on the host being replayed, and from then on
+ * every libusb call is answered from it.  Nothing is opened, no device
+ * is needed and two runs on the same file see exactly the same bus, so
+ * the dump code can be timed and its output compared without hardware.
+ *
+ * Most of this just hands the call to the usbdev_*() wrapper of the same
+ * name, which answers from the loaded snapshot; lsusb mostly calls those
+ * wrappers directly anyway.  There is no asynchronous I/O: requests are
+ * answered at once.
+ *
+ * On Linux $LSUSB_REPLAY may instead name a directory standing in for
+ * "/", such as one made by gen-usb-sysfs.py.  The devices are then those
+ * under its sys/bus/usb/devices, described by their sysfs attributes the
+ * way libusb's own Linux backend does it, and lsusb's sysfs lookups go
+ * there too.  None of them can be opened, as for a user without access
+ * to the tree's dev/bus/usb nodes, so everything shown comes from sysfs.
+ *
+ * Such a tree may change while lsusb --watch runs.  Waiting for events
+ * rescans it every SYSFS_RESCAN_MS, and a device directory that appeared
+ * or went away is reported as a hotplug event, so adding or removing one
+ * by hand, or from a script, drives the watch code.  A recording never
+ * changes and has no hotplug.
+ */
+
+struct libusb_context {
+	int unused;
+};
+
+static struct libusb_context replay_ctx;
+
+#ifdef OS_LINUX
+#define SYSFS_RESCAN_MS	100
+
+struct libusb_device {
+	unsigned int refcnt;		/* the device list holds one */
+	unsigned int location_id;
+	u_int8_t busnum, devnum, nports;
+	u_int8_t ports[7];
+	int speed;
+	struct libusb_device_descriptor desc;
+	char name[MY_PARAM_MAX];	/* "1-2.3", or "usb1" for a root hub */
+};
+
+/* NULL when answering from a snapshot */
+static struct libusb_device **sysfs_devs;
+static unsigned int sysfs_ndevs;
+
+/* the one hotplug callback lsusb registers */
+static struct {
+	libusb_hotplug_callback_fn fn;
+	void *user_data;
+	libusb_hotplug_event events;
+	int vendor_id, product_id, dev_class;
+} hotplug;
+
+/* ---------------------------------------------------------------------- */
+
+static int sysfs_read_string(int dirfd, const char *attr, char *buf, size_t size)
+{
+	ssize_t r;
+	int fd;
+
+	fd = openat(dirfd, attr, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return -1;
+	r = read(fd, buf, size - 1);
+	close(fd);
+	if (r <= 0)
+		return -1;
+	while (r > 0 && (buf[r - 1] == '\n' || buf[r - 1] == ' '))
+		r--;
+	buf[r] = '\0';
+	return 0;
+}
+
+static int sysfs_speed(const char *value)
+{
+	static const struct {
+		const char *value;
+		int speed;
+	} speeds[] = {
+		{ "1.5", LIBUSB_SPEED_LOW },
+		{ "12", LIBUSB_SPEED_FULL },
+		{ "480", LIBUSB_SPEED_HIGH },
+		{ "5000", LIBUSB_SPEED_SUPER },
+	};
+	unsigned int i;
+
+	for (i = 0; i < sizeof(speeds) / sizeof(speeds[0]); i++)
+		if (!strcmp(value, speeds[i].value))
+			return speeds[i].speed;
+	return LIBUSB_SPEED_UNKNOWN;
+}
+
+/* "usb3" or "3-1.4", as the kernel names devices; interfaces are skipped */
+static int sysfs_parse_name(struct libusb_device *dev, const char *name)
+{
+	unsigned long n;
+	char *end;
+
+	if (strlen(name) >= sizeof(dev->name))
+		return -1;
+	if (!strncmp(name, "usb", 3)) {
+		n = strtoul(name + 3, &end, 10);
+		if (*end || !n || n > 255)
+			return -1;
+		dev->busnum = n;
+		dev->nports = 0;
+	} else {
+		n = strtoul(name, &end, 10);
+		if (*end != '-' || !n || n > 255)
+			return -1;
+		dev->busnum = n;
+		dev->nports = 0;
+		do {
+			n = strtoul(end + 1, &end, 10);
+			if (!n || n > 255 || dev->nports == sizeof(dev->ports))
+				return -1;
+			dev->ports[dev->nports++] = n;
+		} while (*end == '.');
+		if (*end)
+			return -1;
+	}
+	strcpy(dev->name, name);
+	return 0;
+}
+
+static int sysfs_read_device(struct libusb_device *dev, const char *name, int dirfd)
+{
+	unsigned char d[LIBUSB_DT_DEVICE_SIZE];
+	char value[MY_PARAM_MAX];
+	unsigned int i;
+	ssize_t r;
+	int fd;
+
+	if (sysfs_parse_name(dev, name) < 0)
+		return -1;
+	if (sysfs_read_string(dirfd, "devnum", value, sizeof(value)) < 0)
+		return -1;
+	dev->devnum = strtoul(value, NULL, 10);
+	dev->speed = sysfs_read_string(dirfd, "speed", value, sizeof(value)) < 0 ?
+		LIBUSB_SPEED_UNKNOWN : sysfs_speed(value);
+
+	fd = openat(dirfd, "descriptors", O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return -1;
+	r = read(fd, d, sizeof(d));
+	close(fd);
+	if (r < (ssize_t)sizeof(d) || d[1] != LIBUSB_DT_DEVICE)
+		return -1;
+	dev->desc.bLength = d[0];
+	dev->desc.bDescriptorType = d[1];
+	dev->desc.bcdUSB = d[2] | (d[3] << 8);
+	dev->desc.bDeviceClass = d[4];
+	dev->desc.bDeviceSubClass = d[5];
+	dev->desc.bDeviceProtocol = d[6];
+	dev->desc.bMaxPacketSize0 = d[7];
+	dev->desc.idVendor = d[8] | (d[9] << 8);
+	dev->desc.idProduct = d[10] | (d[11] << 8);
+	dev->desc.bcdDevice = d[12] | (d[13] << 8);
+	dev->desc.iManufacturer = d[14];
+	dev->desc.iProduct = d[15];
+	dev->desc.iSerialNumber = d[16];
+	dev->desc.bNumConfigurations = d[17];
+
+	dev->location_id = dev->busnum << 24;
+	for (i = 0; i < dev->nports && i < 6; i++)
+		dev->location_id |= (dev->ports[i] & 0xf) << (20 - 4 * i);
+	return 0;
+}
+
+/* libusb lists in directory order; a fixed one keeps runs comparable */
+static int cmp_sysfs_devs(const void *a, const void *b)
+{
+	const struct libusb_device *da = *(struct libusb_device * const *)a;
+	const struct libusb_device *db = *(struct libusb_device * const *)b;
+
+	if (da->busnum != db->busnum)
+		return da->busnum < db->busnum ? -1 : 1;
+	return da->devnum < db->devnum ? -1 : da->devnum > db->devnum;
+}
+
+static struct libusb_device *sysfs_ref(struct libusb_device *dev)
+{
+	dev->refcnt++;
+	return dev;
+}
+
+/* a device that left lives on while lsusb still holds it */
+static void sysfs_unref(struct libusb_device *dev)
+{
+	if (!--dev->refcnt)
+		free(dev);
+}
+
+static void sysfs_free_devs(struct libusb_device **devs, unsigned int n)
+{
+	while (n)
+		sysfs_unref(devs[--n]);
+	free(devs);
+}
+
+/* every device in the tree as it is now, sorted */
+static int sysfs_read_devs(struct libusb_device ***devsp, unsigned int *np)
+{
+	struct libusb_device **devs = NULL, **tmp;
+	unsigned int n = 0, size = 0;
+	struct dirent *de;
+	DIR *dir;
+	int fd;
+
+	dir = opendir(sysfs_devices_path());
+	if (!dir) {
+		fprintf(stderr, "Couldn't open %s\n", sysfs_devices_path());
+		return LIBUSB_ERROR_NOT_FOUND;
+	}
+	while ((de = readdir(dir))) {
+		if (de->d_name[0] == '.' || strchr(de->d_name, ':'))
+			continue;
+		if (n == size) {
+			size = size ? 2 * size : 64;
+			tmp = realloc(devs, size * sizeof(*devs));
+			if (!tmp)
+				goto nomem;
+			devs = tmp;
+		}
+		devs[n] = calloc(1, sizeof(**devs));
+		if (!devs[n])
+			goto nomem;
+		devs[n]->refcnt = 1;
+		fd = openat(dirfd(dir), de->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (fd >= 0 && sysfs_read_device(devs[n], de->d_name, fd) == 0)
+			n++;
+		else
+			free(devs[n]);
+		if (fd >= 0)
+			close(fd);
+	}
+	closedir(dir);
+	if (n)
+		qsort(devs, n, sizeof(*devs), cmp_sysfs_devs);
+	/* an empty bus still answers */
+	*devsp = devs ? devs : calloc(1, sizeof(*devs));
+	*np = n;
+	return *devsp ? LIBUSB_SUCCESS : LIBUSB_ERROR_NO_MEM;
+
+nomem:
+	closedir(dir);
+	sysfs_free_devs(devs, n);
+	return LIBUSB_ERROR_NO_MEM;
+}
+
+static int sysfs_scan(const char *root)
+{
+	if (sysfs_set_root(root) < 0)
+		return LIBUSB_ERROR_INVALID_PARAM;
+	return sysfs_read_devs(&sysfs_devs, &sysfs_ndevs);
+}
+
+/* the same device, not merely one plugged into the same port */
+static int sysfs_same_dev(const struct libusb_device *a, const struct libusb_device *b)
+{
+	return !strcmp(a->name, b->name) && a->devnum == b->devnum &&
+		!memcmp(&a->desc, &b->desc, sizeof(a->desc));
+}
+
+static int sysfs_find_dev(struct libusb_device **devs, unsigned int n,
+			  const struct libusb_device *dev)
+{
+	unsigned int i;
+
+	for (i = 0; i < n; i++)
+		if (sysfs_same_dev(devs[i], dev))
+			return i;
+	return -1;
+}
+
+static void hotplug_notify(struct libusb_device *dev, libusb_hotplug_event event)
+{
+	if (!hotplug.fn || !(hotplug.events & event))
+		return;
+	if ((hotplug.vendor_id != LIBUSB_HOTPLUG_MATCH_ANY &&
+	     hotplug.vendor_id != dev->desc.idVendor) ||
+	    (hotplug.product_id != LIBUSB_HOTPLUG_MATCH_ANY &&
+	     hotplug.product_id != dev->desc.idProduct) ||
+	    (hotplug.dev_class != LIBUSB_HOTPLUG_MATCH_ANY &&
+	     hotplug.dev_class != dev->desc.bDeviceClass))
+		return;
+	/* as with libusb, a callback returning 1 is done */
+	if (hotplug.fn(&replay_ctx, dev, event, hotplug.user_data))
+		hotplug.fn = NULL;
+}
+
+/* what left is reported before what arrived, each in list order */
+static int sysfs_rescan(void)
+{
+	struct libusb_device **devs, **old = sysfs_devs;
+	unsigned int i, n, nold = sysfs_ndevs;
+	int ret, j;
+
+	ret = sysfs_read_devs(&devs, &n);
+	if (ret)
+		return ret;
+	for (i = 0; i < n; i++) {
+		j = sysfs_find_dev(old, nold, devs[i]);
+		if (j < 0)
+			continue;
+		/* one that stayed keeps its libusb_device */
+		sysfs_unref(devs[i]);
+		devs[i] = sysfs_ref(old[j]);
+	}
+	sysfs_devs = devs;
+	sysfs_ndevs = n;
+	for (i = 0; i < nold; i++)
+		if (sysfs_find_dev(devs, n, old[i]) < 0)
+			hotplug_notify(old[i], LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT);
+	for (i = 0; i < n; i++)
+		if (sysfs_find_dev(old, nold, devs[i]) < 0)
+			hotplug_notify(devs[i], LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED);
+	sysfs_free_devs(old, nold);
+	return LIBUSB_SUCCESS;
+}
+#else
+#define sysfs_devs	0
+#endif
+
+/* ---------------------------------------------------------------------- */
+
+int LIBUSB_CALL libusb_init(libusb_context **ctx)
+{
+	const char *path = getenv("LSUSB_REPLAY");
+#ifdef OS_LINUX
+	struct stat st;
+	int ret;
+#endif
+
+	if (!path || !*path) {
+		fprintf(stderr, "LSUSB_REPLAY does not name a file saved by lsusb --save\n");
+		return LIBUSB_ERROR_NOT_FOUND;
+	}
+	if (snapshot_loaded() || sysfs_devs)
+		return LIBUSB_ERROR_BUSY;
+#ifdef OS_LINUX
+	if (!stat(path, &st) && S_ISDIR(st.st_mode)) {
+		ret = sysfs_scan(path);
+		if (ret)
+			return ret;
+	} else
+#endif
+	if (snapshot_load(path) < 0)
+		return LIBUSB_ERROR_IO;
+	if (ctx)
+		*ctx = &replay_ctx;
+	return LIBUSB_SUCCESS;
+}
+
+void LIBUSB_CALL libusb_exit(libusb_context *ctx)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs) {
+		sysfs_free_devs(sysfs_devs, sysfs_ndevs);
+		sysfs_devs = NULL;
+		sysfs_ndevs = 0;
+		hotplug.fn = NULL;
+		return;
+	}
+#endif
+	snapshot_unload();
+}
+
+const char * LIBUSB_CALL libusb_error_name(int errcode)
+{
+	static const char *const names[] = {
+		"LIBUSB_SUCCESS", "LIBUSB_ERROR_IO", "LIBUSB_ERROR_INVALID_PARAM",
+		"LIBUSB_ERROR_ACCESS", "LIBUSB_ERROR_NO_DEVICE",
+		"LIBUSB_ERROR_NOT_FOUND", "LIBUSB_ERROR_BUSY",
+		"LIBUSB_ERROR_TIMEOUT", "LIBUSB_ERROR_OVERFLOW",
+		"LIBUSB_ERROR_PIPE", "LIBUSB_ERROR_INTERRUPTED",
+		"LIBUSB_ERROR_NO_MEM", "LIBUSB_ERROR_NOT_SUPPORTED"
+	};
+
+	if (errcode <= 0 && -errcode < (int)(sizeof(names) / sizeof(names[0])))
+		return names[-errcode];
+	if (errcode == LIBUSB_ERROR_OTHER)
+		return "LIBUSB_ERROR_OTHER";
+	return "**UNKNOWN**";
+}
+
+/* hotplug for a sysfs tree, by rescanning it */
+int LIBUSB_CALL libusb_has_capability(u_int32_t capability)
+{
+	return sysfs_devs && capability == LIBUSB_CAP_HAS_HOTPLUG;
+}
+
+/* ---------------------------------------------------------------------- */
+
+ssize_t LIBUSB_CALL libusb_get_device_list(libusb_context *ctx, libusb_device ***list)
+{
+#ifdef OS_LINUX
+	unsigned int i;
+
+	if (sysfs_devs) {
+		*list = calloc(sysfs_ndevs + 1, sizeof(**list));
+		if (!*list)
+			return LIBUSB_ERROR_NO_MEM;
+		for (i = 0; i < sysfs_ndevs; i++)
+			(*list)[i] = sysfs_ref(sysfs_devs[i]);
+		return sysfs_ndevs;
+	}
+#endif
+	return usbdev_get_device_list(ctx, list);
+}
+
+void LIBUSB_CALL libusb_free_device_list(libusb_device **list, int unref_devices)
+{
+#ifdef OS_LINUX
+	unsigned int i;
+
+	if (sysfs_devs) {
+		for (i = 0; unref_devices && list[i]; i++)
+			sysfs_unref(list[i]);
+		free(list);
+		return;
+	}
+#endif
+	usbdev_free_device_list(list, unref_devices);
+}
+
+libusb_device * LIBUSB_CALL libusb_ref_device(libusb_device *dev)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs)
+		return sysfs_ref(dev);
+#endif
+	return usbdev_ref_device(dev);
+}
+
+void LIBUSB_CALL libusb_unref_device(libusb_device *dev)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs) {
+		sysfs_unref(dev);
+		return;
+	}
+#endif
+	usbdev_unref_device(dev);
+}
+
+int LIBUSB_CALL libusb_get_device_descriptor(libusb_device *dev,
+					     struct libusb_device_descriptor *desc)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs) {
+		*desc = dev->desc;
+		return LIBUSB_SUCCESS;
+	}
+#endif
+	return usbdev_get_device_descriptor(dev, desc);
+}
+
+u_int8_t LIBUSB_CALL libusb_get_bus_number(libusb_device *dev)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs)
+		return dev->busnum;
+#endif
+	return usbdev_get_bus_number(dev);
+}
+
+u_int8_t LIBUSB_CALL libusb_get_device_address(libusb_device *dev)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs)
+		return dev->devnum;
+#endif
+	return usbdev_get_device_address(dev);
+}
+
+int LIBUSB_CALL libusb_get_device_speed(libusb_device *dev)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs)
+		return dev->speed;
+#endif
+	return usbdev_get_device_speed(dev);
+}
+
+int LIBUSB_CALL libusb_get_port_numbers(libusb_device *dev, u_int8_t *ports, int len)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs) {
+		if (len < dev->nports)
+			return LIBUSB_ERROR_OVERFLOW;
+		memcpy(ports, dev->ports, dev->nports);
+		return dev->nports;
+	}
+#endif
+	return usbdev_get_port_numbers(dev, ports, len);
+}
+
+int LIBUSB_CALL libusb_get_config_descriptor(libusb_device *dev, u_int8_t config_index,
+					     struct libusb_config_descriptor **config)
+{
+#ifdef OS_LINUX
+	if (sysfs_devs)
+		return sysfs_get_config_descriptor(sysfs_dev_get(dev->location_id),
+						   config_index, config);
+#endif
+	return snapshot_get_config(dev, config_index, config);
+}
+
+void LIBUSB_CALL libusb_free_config_descriptor(struct libusb_config_descriptor *config)
+{
+	if (config)
+		free_parsed_config(config);
+}
+
+/* as libusb reads it, from the interface rather than the device */
+int LIBUSB_CALL libusb_get_kernel_driver_name(libusb_device *dev, int interface,
+					      unsigned char *buf, int len)
+{
+#ifdef OS_LINUX
+	char path[MY_PATH_MAX], link[MY_PATH_MAX];
+	const char *p;
+	ssize_t l;
+
+	if (sysfs_devs) {
+		if (dev->nports)
+			snprintf(path, sizeof(path), "%s%s/%s:1.%d/driver",
+				 sysfs_devices_path(), dev->name, dev->name, interface);
+		else
+			snprintf(path, sizeof(path), "%s%s/%u-0:1.%d/driver",
+				 sysfs_devices_path(), dev->name, dev->busnum, interface);
+		l = readlink(path, link, sizeof(link) - 1);
+		if (l < 0)
+			return LIBUSB_ERROR_NOT_FOUND;
+		link[l] = '\0';
+		p = strrchr(link, '/');
+		snprintf((char *)buf, len, "%s", p ? p + 1 : link);
+		return LIBUSB_SUCCESS;
+	}
+#endif
+	return usbdev_get_kernel_driver_name(dev, interface, buf, len);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+ * A device of a sysfs tree is opened as libusb opens one, so what a mode
+ * costs in syscalls includes the devices it tries to open, and is then
+ * refused: nothing in the tree answers requests.
+ */
+int LIBUSB_CALL libusb_open(libusb_device *dev, libusb_device_handle **handle)
+{
+#ifdef OS_LINUX
+	char path[MY_PATH_MAX];
+	int fd;
+
+	if (sysfs_devs) {
+		snprintf(path, sizeof(path), "%s/%03u/%03u", usbfs_path(),
+			 dev->busnum, dev->devnum);
+		fd = open(path, O_RDWR | O_CLOEXEC);
+		if (fd >= 0)
+			close(fd);
+		return LIBUSB_ERROR_ACCESS;
+	}
+#endif
+	return usbdev_open(dev, handle);
+}
+
+int LIBUSB_CALL libusb_open_extended(libusb_device *dev, libusb_device_handle **handle,
+				     struct libusb_options *options,
+				     struct libusb_os_options *os_options)
+{
+	return libusb_open(dev, handle);
+}
+
+/* nothing in a sysfs tree is ever opened */
+void LIBUSB_CALL libusb_close(libusb_device_handle *dev_handle)
+{
+	if (!sysfs_devs)
+		usbdev_close(dev_handle);
+}
+
+libusb_device * LIBUSB_CALL libusb_get_device(libusb_device_handle *dev_handle)
+{
+	return sysfs_devs ? NULL : usbdev_get_device(dev_handle);
+}
+
+int LIBUSB_CALL libusb_claim_interface(libusb_device_handle *dev, int interface_number)
+{
+	return sysfs_devs ? LIBUSB_ERROR_NO_DEVICE :
+		usbdev_claim_interface(dev, interface_number);
+}
+
+int LIBUSB_CALL libusb_release_interface(libusb_device_handle *dev, int interface_number)
+{
+	return sysfs_devs ? LIBUSB_ERROR_NO_DEVICE :
+		usbdev_release_interface(dev, interface_number);
+}
+
+/* options only tune how a real device is opened */
+int LIBUSB_CALL libusb_get_options(libusb_device_handle *dev_handle,
+				   struct libusb_options **options,
+				   struct libusb_os_options **os_options)
+{
+	if (options && !(*options = calloc(1, sizeof(**options))))
+		return LIBUSB_ERROR_NO_MEM;
+	if (os_options && !(*os_options = calloc(1, sizeof(**os_options)))) {
+		if (options) {
+			free(*options);
+			*options = NULL;
+		}
+		return LIBUSB_ERROR_NO_MEM;
+	}
+	return LIBUSB_SUCCESS;
+}
+
+int LIBUSB_CALL libusb_set_options(libusb_device_handle *dev_handle,
+				   struct libusb_options *options,
+				   struct libusb_os_options *os_options)
+{
+	return LIBUSB_SUCCESS;
+}
+
+void LIBUSB_CALL libusb_free_options(struct libusb_options *options,
+				     struct libusb_os_options *os_options)
+{
+	free(options);
+	free(os_options);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int LIBUSB_CALL libusb_control_transfer(libusb_device_handle *dev_handle,
+					u_int8_t request_type, u_int8_t bRequest,
+					u_int16_t wValue, u_int16_t wIndex,
+					unsigned char *data, u_int16_t wLength,
+					unsigned int timeout)
+{
+	if (sysfs_devs)
+		return LIBUSB_ERROR_NO_DEVICE;
+	return snapshot_control(dev_handle, request_type, bRequest, wValue, wIndex,
+				data, wLength);
+}
+/* as libusb does it: the first language, then UTF-16LE folded to ASCII */
+int LIBUSB_CALL libusb_get_string_descriptor_ascii(libusb_device_handle *dev,
+						   u_int8_t desc_index,
+						   unsigned char *data, int length)
+{
+	unsigned char buf[255];
+	int ret, i, n;
+
+	if (!desc_index || length <= 0)
+		return LIBUSB_ERROR_INVALID_PARAM;
+	ret = libusb_control_transfer(dev, LIBUSB_ENDPOINT_IN, LIBUSB_REQUEST_GET_DESCRIPTOR,
+				      LIBUSB_DT_STRING << 8, 0, buf, sizeof(buf), 1000);
+	if (ret < 0)
+		return ret;
+	if (ret < 4)
+		return LIBUSB_ERROR_IO;
+	ret = libusb_control_transfer(dev, LIBUSB_ENDPOINT_IN, LIBUSB_REQUEST_GET_DESCRIPTOR,
+				      (LIBUSB_DT_STRING << 8) | desc_index,
+				      buf[2] | (buf[3] << 8), buf, sizeof(buf), 1000);
+	if (ret < 0)
+		return ret;
+	if (buf[1] != LIBUSB_DT_STRING || buf[0] > ret)
+		return LIBUSB_ERROR_IO;
+	for (i = 2, n = 0; i + 1 < buf[0] && n < length - 1; i += 2)
+		data[n++] = buf[i + 1] || buf[i] & 0x80 ? '?' : buf[i];
+	data[n] = 0;
+	return n;
+}
+
+/* requests are answered at once, so lsusb never has them queued */
+struct libusb_transfer * LIBUSB_CALL libusb_alloc_transfer(int iso_packets)
+{
+	return NULL;
+}
+
+int LIBUSB_CALL libusb_submit_transfer(struct libusb_transfer *transfer)
+{
+	return LIBUSB_ERROR_NOT_SUPPORTED;
+}
+
+int LIBUSB_CALL libusb_cancel_transfer(struct libusb_transfer *transfer)
+{
+	return LIBUSB_ERROR_NOT_FOUND;
+}
+
+void LIBUSB_CALL libusb_free_transfer(struct libusb_transfer *transfer)
+{
+}
+
+/* the only events are a sysfs tree's devices coming and going */
+int LIBUSB_CALL libusb_handle_events_timeout_completed(libusb_context *ctx,
+		struct timeval *tv, int *completed)
+{
+#ifdef OS_LINUX
+	int ms = SYSFS_RESCAN_MS;
+
+	if (sysfs_devs && hotplug.fn) {
+		if (tv && tv->tv_sec * 1000 + tv->tv_usec / 1000 < ms)
+			ms = tv->tv_sec * 1000 + tv->tv_usec / 1000;
+		if (poll(NULL, 0, ms) < 0 && errno == EINTR)
+			return LIBUSB_ERROR_INTERRUPTED;
+		return sysfs_rescan();
+	}
+#endif
+	return LIBUSB_ERROR_NOT_SUPPORTED;
+}
+
+int LIBUSB_CALL libusb_handle_events_completed(libusb_context *ctx, int *completed)
+{
+	return libusb_handle_events_timeout_completed(ctx, NULL, completed);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int LIBUSB_CALL libusb_hotplug_register_callback(libusb_context *ctx,
+		libusb_hotplug_event events, libusb_hotplug_flag flags,
+		int vendor_id, int product_id, int dev_class,
+		libusb_hotplug_callback_fn cb_fn, void *user_data,
+		libusb_hotplug_callback_handle *handle)
+{
+#ifdef OS_LINUX
+	unsigned int i;
+
+	if (!sysfs_devs)
+		return LIBUSB_ERROR_NOT_SUPPORTED;
+	if (hotplug.fn)
+		return LIBUSB_ERROR_BUSY;
+	hotplug.fn = cb_fn;
+	hotplug.user_data = user_data;
+	hotplug.events = events;
+	hotplug.vendor_id = vendor_id;
+	hotplug.product_id = product_id;
+	hotplug.dev_class = dev_class;
+	if (handle)
+		*handle = 1;
+	if (flags & LIBUSB_HOTPLUG_ENUMERATE)
+		for (i = 0; i < sysfs_ndevs && hotplug.fn; i++)
+			hotplug_notify(sysfs_devs[i], LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED);
+	return LIBUSB_SUCCESS;
+#else
+	return LIBUSB_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+void LIBUSB_CALL libusb_hotplug_deregister_callback(libusb_context *ctx,
+						    libusb_hotplug_callback_handle handle)
+{
+#ifdef OS_LINUX
+	hotplug.fn = NULL;
+#endif
+}
+
+#ifdef HAVE_LIBUSB_WRAP_SYS_DEVICE
+/* a recording has no nodes to open, so lsusb -D looks in the list */
+int LIBUSB_CALL libusb_set_option(libusb_context *ctx, enum libusb_option option, ...)
+{
+	return LIBUSB_ERROR_NOT_SUPPORTED;
+}
+
+int LIBUSB_CALL libusb_wrap_sys_device(libusb_context *ctx, intptr_t sys_dev,
+				       libusb_device_handle **dev_handle)
+{
+	return LIBUSB_ERROR_NOT_SUPPORTED;
+}
+#endif
@@ -0,0 +1,672 @@
+/*****************************************************************************/
+
+/*
+ *      usbxfer.c  --  pipelined control transfers
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "list.h"
+#include "snapshot.h"
+#include "timing.h"
+#include "usbmisc.h"
+#include "usbxfer.h"
+
+#define XFER_HASHSZ 256
+
+/*
+ * lsusb --stats counts every request that goes to a device, per kind of
+ * request and per device: how many, bytes received, retries, failures by
+ * libusb error, and latency in buckets of powers of two microseconds.
+ * A retry is the same request again on the same handle right after it
+ * failed, or returned less of a descriptor than the descriptor itself
+ * declares and the caller asked for.  Reading a header first and then
+ * the whole descriptor is not a retry.
+ */
+
+#define XFER_NBUCKETS	24	/* the last one starts at 8 s, past CTRL_TIMEOUT */
+#define XFER_NERRORS	13	/* LIBUSB_ERROR_IO ... _NOT_SUPPORTED, then others */
+#define XFER_STATS_HASHSZ 64
+#define XFER_STATS_TOP	10
+
+struct xfer_stats {
+	unsigned long count, bytes, retries, failed;
+	unsigned long errors[XFER_NERRORS];
+	unsigned long latency[XFER_NBUCKETS];
+	u_int64_t total, max;		/* nanoseconds */
+};
+
+struct xfer_stats_entry {
+	struct xfer_stats_entry *next;
+	unsigned int key;		/* XFER_KIND(), or a location ID */
+	struct xfer_stats s;
+};
+
+struct xfer_req {
+	struct list_head list;
+	libusb_device_handle *hdev;
+	struct libusb_transfer *transfer;
+	u_int8_t requesttype, request;
+	u_int16_t value, idx, length;
+	int done;
+	int status;
+	int err;			/* errno to report with a failed status */
+	u_int64_t started;		/* for --timing */
+	xfer_done_fn fn;
+	void *user_data;
+};
+
+static libusb_context *xfer_ctx;	/* NULL is the default context */
+static int xfer_ready;
+static struct list_head xfer_hash[XFER_HASHSZ];
+
+int xfer_stats_enabled;
+static struct xfer_stats stats_all;
+static struct xfer_stats_entry *stats_kinds;
+static struct xfer_stats_entry *stats_devices[XFER_STATS_HASHSZ];
+static struct {
+	libusb_device_handle *hdev;
+	u_int8_t requesttype, request;
+	u_int16_t value, idx;
+	int incomplete;
+} stats_last;
+
+/* ---------------------------------------------------------------------- */
+
+static const char *descriptor_name(unsigned int type)
+{
+	switch (type) {
+	case 0x01:	return "DEVICE";
+	case 0x02:	return "CONFIG";
+	case 0x03:	return "STRING";
+	case 0x06:	return "DEVICE_QUALIFIER";
+	case 0x07:	return "OTHER_SPEED";
+	case 0x0a:	return "DEBUG";
+	case 0x0f:	return "BOS";
+	case 0x21:	return "HID";
+	case 0x22:	return "REPORT";
+	case 0x29:	return "HUB";
+	case 0x2a:	return "SS_HUB";
+	default:	return NULL;
+	}
+}
+
+/* "GET_DESCRIPTOR(STRING)", "class request 0x00 other" and the like */
+void xfer_kind_name(unsigned int kind, char *buf, size_t size)
+{
+	static const char *const requests[] = {
+		"GET_STATUS", "CLEAR_FEATURE", NULL, "SET_FEATURE", NULL,
+		"SET_ADDRESS", "GET_DESCRIPTOR", "SET_DESCRIPTOR",
+		"GET_CONFIGURATION", "SET_CONFIGURATION", "GET_INTERFACE",
+		"SET_INTERFACE", "SYNCH_FRAME"
+	};
+	static const char *const recipients[] = { "device", "interface", "endpoint", "other" };
+	static const char *const types[] = { "", "class ", "vendor ", "reserved " };
+	unsigned int requesttype = kind >> 16, request = (kind >> 8) & 0xff;
+	const char *recipient = (requesttype & 0x1f) < 4 ? recipients[requesttype & 0x1f] : "?";
+	const char *type = types[(requesttype >> 5) & 3];
+	const char *name;
+
+	if (request == 6 && !(requesttype & 0x40)) {
+		name = descriptor_name(kind & 0xff);
+		if (name)
+			snprintf(buf, size, "%sGET_DESCRIPTOR(%s)", type, name);
+		else
+			snprintf(buf, size, "%sGET_DESCRIPTOR(0x%02x)", type, kind & 0xff);
+	} else if (!(requesttype & 0x60) && request < sizeof(requests) / sizeof(requests[0]) &&
+		   requests[request]) {
+		snprintf(buf, size, "%s %s", requests[request], recipient);
+	} else {
+		snprintf(buf, size, "%srequest 0x%02x %s", type, request, recipient);
+	}
+}
+
+/* ---------------------------------------------------------------------- */
+
+static u_int64_t xfer_clock(void)
+{
+	return timing_enabled || xfer_stats_enabled ? timing_now() : 0;
+}
+
+static struct xfer_stats *stats_get(struct xfer_stats_entry **head, unsigned int key)
+{
+	struct xfer_stats_entry *e;
+
+	for (e = *head; e; e = e->next)
+		if (e->key == key)
+			return &e->s;
+	e = calloc(1, sizeof(*e));
+	if (!e)
+		return NULL;
+	e->key = key;
+	e->next = *head;
+	*head = e;
+	return &e->s;
+}
+
+static void stats_add(struct xfer_stats *s, int status, u_int64_t ns)
+{
+	u_int64_t us = ns / 1000;
+	unsigned int b = 0;
+
+	if (!s)
+		return;
+	s->count++;
+	if (status > 0)
+		s->bytes += status;
+	if (status < 0) {
+		s->failed++;
+		s->errors[status >= -(XFER_NERRORS - 1) ? -status - 1 : XFER_NERRORS - 1]++;
+	}
+	while (us && b < XFER_NBUCKETS - 1) {
+		us >>= 1;
+		b++;
+	}
+	s->latency[b]++;
+	s->total += ns;
+	if (ns > s->max)
+		s->max = ns;
+}
+
+/* a request that went to the device has completed */
+static void xfer_account(libusb_device_handle *hdev, u_int8_t requesttype,
+			 u_int8_t request, u_int16_t value, int status, u_int64_t start)
+{
+	unsigned int kind = XFER_KIND(requesttype, request, value);
+	unsigned int location_id;
+	u_int64_t ns;
+
+	if (!start)
+		return;
+	ns = timing_now() - start;
+	location_id = get_location_id(usbdev_get_device(hdev));
+	if (timing_enabled)
+		timing_record(TIMING_CONTROL, NULL, kind, location_id, start);
+	if (!xfer_stats_enabled)
+		return;
+	stats_add(&stats_all, status, ns);
+	stats_add(stats_get(&stats_kinds, kind), status, ns);
+	stats_add(stats_get(&stats_devices[location_id % XFER_STATS_HASHSZ], location_id),
+		  status, ns);
+}
+
+/* whether asking again for the same thing would be a retry */
+static int xfer_incomplete(u_int8_t requesttype, u_int8_t request, u_int16_t value,
+			   const unsigned char *data, int ret, u_int16_t size)
+{
+	unsigned int declared;
+
+	if (ret < 0)
+		return 1;
+	if (request != LIBUSB_REQUEST_GET_DESCRIPTOR || (requesttype & 0x40))
+		return 0;
+	if (ret < 2)
+		return ret < size;
+	declared = data[0];
+	switch (value >> 8) {
+	case LIBUSB_DT_CONFIG:
+	case 0x07:		/* other speed configuration */
+	case LIBUSB_DT_BOS:
+		if (ret >= 4)
+			declared = data[2] | (data[3] << 8);
+		break;
+	}
+	return (unsigned int)ret < declared && ret < size;
+}
+
+/* every request asked for, whether or not it needs the bus */
+static void xfer_count_retry(libusb_device_handle *hdev, u_int8_t requesttype,
+			     u_int8_t request, u_int16_t value, u_int16_t idx)
+{
+	unsigned int location_id;
+	struct xfer_stats *s;
+
+	if (!stats_last.incomplete || stats_last.hdev != hdev ||
+	    stats_last.requesttype != requesttype || stats_last.request != request ||
+	    stats_last.value != value || stats_last.idx != idx)
+		return;
+	location_id = get_location_id(usbdev_get_device(hdev));
+	stats_all.retries++;
+	if ((s = stats_get(&stats_kinds, XFER_KIND(requesttype, request, value))))
+		s->retries++;
+	if ((s = stats_get(&stats_devices[location_id % XFER_STATS_HASHSZ], location_id)))
+		s->retries++;
+}
+
+static unsigned int xfer_hashfn(libusb_device_handle *hdev, u_int8_t request,
+				u_int16_t value, u_int16_t idx)
+{
+	unsigned long h = (unsigned long)hdev;
+
+	h ^= h >> 9;
+	h += (request << 4) ^ (value * 31) ^ (idx * 7);
+	return h & (XFER_HASHSZ - 1);
+}
+
+static struct xfer_req *xfer_find(libusb_device_handle *hdev, u_int8_t requesttype,
+				  u_int8_t request, u_int16_t value, u_int16_t idx,
+				  u_int16_t length)
+{
+	struct list_head *head, *pos;
+
+	if (!xfer_ready)
+		return NULL;
+	head = &xfer_hash[xfer_hashfn(hdev, request, value, idx)];
+	for (pos = head->next; pos != head; pos = pos->next) {
+		struct xfer_req *req = list_entry(pos, struct xfer_req, list);
+
+		if (req->hdev == hdev && req->requesttype == requesttype &&
+		    req->request == request && req->value == value &&
+		    req->idx == idx && req->length == length)
+			return req;
+	}
+	return NULL;
+}
+
+/* same results libusb_control_transfer() would give */
+static int xfer_status(const struct libusb_transfer *transfer)
+{
+	switch (transfer->status) {
+	case LIBUSB_TRANSFER_COMPLETED:
+		return transfer->actual_length;
+	case LIBUSB_TRANSFER_TIMED_OUT:
+		return LIBUSB_ERROR_TIMEOUT;
+	case LIBUSB_TRANSFER_STALL:
+		return LIBUSB_ERROR_PIPE;
+	case LIBUSB_TRANSFER_NO_DEVICE:
+		return LIBUSB_ERROR_NO_DEVICE;
+	case LIBUSB_TRANSFER_OVERFLOW:
+		return LIBUSB_ERROR_OVERFLOW;
+	case LIBUSB_TRANSFER_CANCELLED:
+		return LIBUSB_ERROR_INTERRUPTED;
+	default:
+		return LIBUSB_ERROR_IO;
+	}
+}
+
+/*
+ * What errno says after a failed synchronous transfer, for callers that
+ * look at it; a completed transfer leaves nothing meaningful in errno.
+ */
+static int xfer_errno(int status)
+{
+	switch (status) {
+	case LIBUSB_ERROR_ACCESS:
+		return EACCES;
+	case LIBUSB_ERROR_NO_DEVICE:
+		return ENODEV;
+	case LIBUSB_ERROR_NOT_FOUND:
+		return ENOENT;
+	case LIBUSB_ERROR_BUSY:
+		return EBUSY;
+	case LIBUSB_ERROR_TIMEOUT:
+		return ETIMEDOUT;
+	case LIBUSB_ERROR_OVERFLOW:
+		return EOVERFLOW;
+	case LIBUSB_ERROR_PIPE:
+		return EPIPE;
+	case LIBUSB_ERROR_INTERRUPTED:
+		return EINTR;
+	case LIBUSB_ERROR_NO_MEM:
+		return ENOMEM;
+	case LIBUSB_ERROR_NOT_SUPPORTED:
+		return ENOSYS;
+	default:
+		return EIO;
+	}
+}
+
+static void LIBUSB_CALL xfer_callback(struct libusb_transfer *transfer)
+{
+	struct xfer_req *req = transfer->user_data;
+
+	req->status = xfer_status(transfer);
+	req->err = req->status < 0 ? xfer_errno(req->status) : 0;
+	req->done = 1;
+	/* from submission, all of it spent on the bus or queued for it */
+	if (transfer->status != LIBUSB_TRANSFER_CANCELLED)
+		xfer_account(req->hdev, req->requesttype, req->request, req->value,
+			     req->status, req->started);
+	/* what was given up on is not an answer worth keeping */
+	if (snapshot_recording() && transfer->status != LIBUSB_TRANSFER_CANCELLED)
+		snapshot_record_control(req->hdev, req->requesttype, req->request,
+					req->value, req->idx, req->length,
+					libusb_control_transfer_get_data(transfer),
+					req->status);
+	/* the callback may queue follow-up requests */
+	if (req->fn)
+		req->fn(req->hdev, req->status,
+			libusb_control_transfer_get_data(transfer), req->user_data);
+}
+
+static void xfer_wait(struct xfer_req *req)
+{
+	while (!req->done)
+		if (libusb_handle_events_completed(xfer_ctx, &req->done) < 0 &&
+		    !req->done) {
+			/* the event loop is broken, give up on this one */
+			if (libusb_cancel_transfer(req->transfer) < 0) {
+				req->status = LIBUSB_ERROR_IO;
+				req->err = EIO;
+				req->done = 1;
+			}
+		}
+}
+
+/* ---------------------------------------------------------------------- */
+
+void xfer_init(libusb_context *ctx)
+{
+	unsigned int i;
+
+	for (i = 0; i < XFER_HASHSZ; i++)
+		INIT_LIST_HEAD(&xfer_hash[i]);
+	xfer_ctx = ctx;
+	xfer_ready = 1;
+}
+
+int xfer_prefetch(libusb_device_handle *hdev, u_int8_t requesttype,
+		  u_int8_t request, u_int16_t value, u_int16_t idx,
+		  u_int16_t length, unsigned int timeout,
+		  xfer_done_fn done, void *user_data)
+{
+	struct xfer_req *req;
+	unsigned char *buf;
+
+	/* a loaded snapshot answers at once, nothing to queue */
+	if (!xfer_ready || !hdev || !(requesttype & LIBUSB_ENDPOINT_IN) ||
+	    snapshot_loaded())
+		goto fail;
+	if (xfer_find(hdev, requesttype, request, value, idx, length))
+		goto fail;
+
+	req = calloc(1, sizeof(*req));
+	buf = malloc(LIBUSB_CONTROL_SETUP_SIZE + length);
+	if (req)
+		req->transfer = libusb_alloc_transfer(0);
+	if (!req || !buf || !req->transfer) {
+		if (req)
+			libusb_free_transfer(req->transfer);
+		free(req);
+		free(buf);
+		goto fail;
+	}
+	req->hdev = hdev;
+	req->requesttype = requesttype;
+	req->request = request;
+	req->value = value;
+	req->idx = idx;
+	req->length = length;
+	req->fn = done;
+	req->user_data = user_data;
+
+	libusb_fill_control_setup(buf, requesttype, request, value, idx, length);
+	libusb_fill_control_transfer(req->transfer, hdev, buf, xfer_callback, req, timeout);
+	req->started = xfer_clock();
+	if (libusb_submit_transfer(req->transfer) < 0) {
+		free(buf);
+		libusb_free_transfer(req->transfer);
+		free(req);
+		goto fail;
+	}
+	list_add_tail(&req->list, &xfer_hash[xfer_hashfn(hdev, request, value, idx)]);
+	return 0;
+
+fail:
+	/* done functions own their user_data */
+	if (done)
+		done(hdev, LIBUSB_ERROR_OTHER, NULL, user_data);
+	return -1;
+}
+
+int xfer_control(libusb_device_handle *hdev, u_int8_t requesttype,
+		 u_int8_t request, u_int16_t value, u_int16_t idx,
+		 unsigned char *data, u_int16_t size, unsigned int timeout)
+{
+	struct xfer_req *req;
+	u_int64_t start;
+	int ret, err;
+
+	if (snapshot_loaded()) {
+		ret = snapshot_control(hdev, requesttype, request, value, idx,
+				       data, size);
+		if (ret < 0)
+			errno = xfer_errno(ret);
+		return ret;
+	}
+	if (xfer_stats_enabled)
+		xfer_count_retry(hdev, requesttype, request, value, idx);
+	req = xfer_find(hdev, requesttype, request, value, idx, size);
+	if (!req) {
+		start = xfer_clock();
+		ret = libusb_control_transfer(hdev, requesttype, request, value,
+					      idx, data, size, timeout);
+		err = errno;
+		xfer_account(hdev, requesttype, request, value, ret, start);
+		if (snapshot_recording())
+			snapshot_record_control(hdev, requesttype, request, value,
+						idx, size, data, ret);
+	} else {
+		xfer_wait(req);
+		if (req->status > 0)
+			memcpy(data, libusb_control_transfer_get_data(req->transfer),
+			       req->status);
+		ret = req->status;
+		err = req->err;
+	}
+	if (xfer_stats_enabled) {
+		stats_last.hdev = hdev;
+		stats_last.requesttype = requesttype;
+		stats_last.request = request;
+		stats_last.value = value;
+		stats_last.idx = idx;
+		stats_last.incomplete = xfer_incomplete(requesttype, request, value,
+							data, ret, size);
+	}
+	/* callers tell failures apart by errno, as after the real transfer */
+	if (ret < 0)
+		errno = err;
+	return ret;
+}
+
+void xfer_release(libusb_device_handle *hdev)
+{
+	unsigned int i;
+	int found;
+
+	/* a new handle may get the same address */
+	if (stats_last.hdev == hdev)
+		stats_last.hdev = NULL;
+	if (!xfer_ready)
+		return;
+	/* waiting runs callbacks, which can queue more for this device */
+	do {
+		found = 0;
+		for (i = 0; i < XFER_HASHSZ; i++) {
+			struct list_head *pos = xfer_hash[i].next;
+
+			while (pos != &xfer_hash[i]) {
+				struct xfer_req *req = list_entry(pos, struct xfer_req, list);
+
+				if (req->hdev != hdev) {
+					pos = pos->next;
+					continue;
+				}
+				found = 1;
+				if (!req->done)
+					libusb_cancel_transfer(req->transfer);
+				xfer_wait(req);
+				pos = pos->next;
+				list_del(&req->list);
+				free(req->transfer->buffer);
+				libusb_free_transfer(req->transfer);
+				free(req);
+			}
+		}
+	} while (found);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void xfer_stats_enable(void)
+{
+	xfer_stats_enabled = 1;
+}
+
+static void stats_print_latency(const struct xfer_stats *s)
+{
+	unsigned long us;
+	unsigned int b;
+
+	fprintf(stderr, "    latency");
+	for (b = 0; b < XFER_NBUCKETS; b++) {
+		if (!s->latency[b])
+			continue;
+		/* under 2^b microseconds; the last bucket has no end */
+		us = 1ul << b;
+		if (b == XFER_NBUCKETS - 1)
+			fprintf(stderr, "  more:%lu", s->latency[b]);
+		else if (us < 1000)
+			fprintf(stderr, "  <%luus:%lu", us, s->latency[b]);
+		else if (us < 1000000)
+			fprintf(stderr, "  <%gms:%lu", us / 1e3, s->latency[b]);
+		else
+			fprintf(stderr, "  <%gs:%lu", us / 1e6, s->latency[b]);
+	}
+	fprintf(stderr, "\n");
+}
+
+static void stats_print_errors(const struct xfer_stats *s)
+{
+	unsigned int i;
+	const char *sep = "    errors ";
+
+	if (!s->failed)
+		return;
+	for (i = 0; i < XFER_NERRORS; i++) {
+		if (!s->errors[i])
+			continue;
+		fprintf(stderr, "%s%s:%lu", sep,
+			i < XFER_NERRORS - 1 ? libusb_error_name(-(int)i - 1) : "other",
+			s->errors[i]);
+		sep = "  ";
+	}
+	fprintf(stderr, "\n");
+}
+
+static void stats_print_line(const char *name, const struct xfer_stats *s)
+{
+	fprintf(stderr, "%-30s %7lu %9lu %7lu %7lu %10.3f %10.3f\n", name,
+		s->count, s->bytes, s->retries, s->failed,
+		s->count ? s->total / 1e6 / s->count : 0.0, s->max / 1e6);
+}
+
+static int cmp_stats_kinds(const void *a, const void *b)
+{
+	const struct xfer_stats_entry *ea = *(const struct xfer_stats_entry * const *)a;
+	const struct xfer_stats_entry *eb = *(const struct xfer_stats_entry * const *)b;
+
+	return ea->s.total > eb->s.total ? -1 : ea->s.total < eb->s.total;
+}
+
+/* flaky first, then slow */
+static int cmp_stats_devices(const void *a, const void *b)
+{
+	const struct xfer_stats_entry *ea = *(const struct xfer_stats_entry * const *)a;
+	const struct xfer_stats_entry *eb = *(const struct xfer_stats_entry * const *)b;
+	unsigned long fa = ea->s.failed + ea->s.retries, fb = eb->s.failed + eb->s.retries;
+
+	if (fa != fb)
+		return fa > fb ? -1 : 1;
+	return ea->s.max > eb->s.max ? -1 : ea->s.max < eb->s.max;
+}
+
+static void stats_free(struct xfer_stats_entry *e)
+{
+	struct xfer_stats_entry *next;
+
+	for (; e; e = next) {
+		next = e->next;
+		free(e);
+	}
+}
+
+/* on stderr, so it does not mix with the output */
+void xfer_stats_print(void)
+{
+	struct xfer_stats_entry **sorted, *e;
+	unsigned int n = 0, i, h;
+	char name[64];
+
+	if (!xfer_stats_enabled)
+		return;
+
+	for (e = stats_kinds; e; e = e->next)
+		n++;
+	for (h = 0; h < XFER_STATS_HASHSZ; h++)
+		for (e = stats_devices[h]; e; e = e->next)
+			n++;
+	sorted = calloc(n ? n : 1, sizeof(*sorted));
+	if (!sorted)
+		goto out;
+
+	fprintf(stderr, "\n%-30s %7s %9s %7s %7s %10s %10s\n", "control requests",
+		"count", "bytes", "retries", "failed", "avg ms", "max ms");
+	stats_print_line("all", &stats_all);
+	stats_print_errors(&stats_all);
+	stats_print_latency(&stats_all);
+
+	for (n = 0, e = stats_kinds; e; e = e->next)
+		sorted[n++] = e;
+	qsort(sorted, n, sizeof(*sorted), cmp_stats_kinds);
+	for (i = 0; i < n; i++) {
+		xfer_kind_name(sorted[i]->key, name, sizeof(name));
+		stats_print_line(name, &sorted[i]->s);
+		stats_print_errors(&sorted[i]->s);
+		stats_print_latency(&sorted[i]->s);
+	}
+
+	for (n = 0, h = 0; h < XFER_STATS_HASHSZ; h++)
+		for (e = stats_devices[h]; e; e = e->next)
+			sorted[n++] = e;
+	qsort(sorted, n, sizeof(*sorted), cmp_stats_devices);
+	if (n)
+		fprintf(stderr, "\n%-30s %7s %9s %7s %7s %10s %10s\n", "devices",
+			"count", "bytes", "retries", "failed", "avg ms", "max ms");
+	for (i = 0; i < n && i < XFER_STATS_TOP; i++) {
+		timing_location_name(sorted[i]->key, name, sizeof(name));
+		stats_print_line(name, &sorted[i]->s);
+		stats_print_errors(&sorted[i]->s);
+	}
+	free(sorted);
+
+out:
+	stats_free(stats_kinds);
+	stats_kinds = NULL;
+	for (h = 0; h < XFER_STATS_HASHSZ; h++) {
+		stats_free(stats_devices[h]);
+		stats_devices[h] = NULL;
+	}
+	xfer_stats_enabled = 0;
+}
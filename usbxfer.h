@@ -0,0 +1,65 @@
+/*****************************************************************************/
+
+/*
+ *      usbxfer.h  --  pipelined control transfers
+ *
+ *      This program is free software; you can redistribute it and/or modify
+ *      it under the terms of the GNU General Public License as published by
+ *      the Free Software Foundation; either version 2 of the License, or
+ *      (at your option) any later version.
+ *
+ *      This program is distributed in the hope that it will be useful,
+ *      but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *      GNU General Public License for more details.
+ *
+ *
+ */
+
+/*****************************************************************************/
+
+#ifndef _USBXFER_H
+#define _USBXFER_H
+
+#include <sys/types.h>
+#include <libusb.h>
+
+/*
+ * Requests that are known to be needed can be submitted ahead of time
+ * with xfer_prefetch(); they run concurrently, across devices, and
+ * complete in any order.  xfer_control() is a drop-in replacement for
+ * libusb_control_transfer(): it waits for and returns a matching
+ * prefetched result if there is one, and does a normal synchronous
+ * transfer otherwise.  A failed result comes with errno set from the
+ * request it answers, never left over from something later.  Results
+ * stay available until xfer_release().
+ */
+
+/* status is the length received, or a LIBUSB_ERROR code */
+typedef void (*xfer_done_fn)(libusb_device_handle *hdev, int status,
+			     const unsigned char *data, void *user_data);
+
+extern void xfer_init(libusb_context *ctx);
+extern int xfer_prefetch(libusb_device_handle *hdev, u_int8_t requesttype,
+			 u_int8_t request, u_int16_t value, u_int16_t idx,
+			 u_int16_t length, unsigned int timeout,
+			 xfer_done_fn done, void *user_data);
+extern int xfer_control(libusb_device_handle *hdev, u_int8_t requesttype,
+			u_int8_t request, u_int16_t value, u_int16_t idx,
+			unsigned char *data, u_int16_t size, unsigned int timeout);
+extern void xfer_release(libusb_device_handle *hdev);
+
+/* requests told apart by type, request and descriptor type */
+#define XFER_KIND(requesttype, request, value) \
+	(((requesttype) << 16) | ((request) << 8) | \
+	 ((request) == 6 && !((requesttype) & 0x40) ? ((value) >> 8) & 0xff : 0))
+
+extern void xfer_kind_name(unsigned int kind, char *buf, size_t size);
+
+/* lsusb --stats */
+extern int xfer_stats_enabled;
+extern void xfer_stats_enable(void);
+extern void xfer_stats_print(void);
+
+/* ---------------------------------------------------------------------- */
+#endif /* _USBXFER_H */